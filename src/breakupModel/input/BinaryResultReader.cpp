@@ -0,0 +1,112 @@
+#include "BinaryResultReader.h"
+
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
+
+BinaryResultReader::BinaryResultReader(const std::string &filename)
+        : _file{filename} {
+    parse(filename);
+}
+
+void BinaryResultReader::parse(const std::string &filename) {
+    using namespace util::binary;
+    FileHeader header{};
+    if (_file.size() < sizeof(FileHeader)) {
+        throw std::runtime_error{"The file " + filename + " is too small to be a binary result file!"};
+    }
+    std::memcpy(&header, _file.data(), sizeof(FileHeader));
+    if (header.magic != MAGIC) {
+        throw std::runtime_error{"The file " + filename + " is no binary result file!"};
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error{"The file " + filename + " has the unsupported version "
+                                 + std::to_string(header.version) + "!"};
+    }
+    if (header.byteOrderMark != BYTE_ORDER_MARK) {
+        throw std::runtime_error{"The file " + filename + " was written with a different byte order!"};
+    }
+    if (header.columnTableOffset > _file.size()
+        || header.columnCount > (_file.size() - header.columnTableOffset) / sizeof(ColumnEntry)) {
+        throw std::runtime_error{"The column table of " + filename + " is truncated!"};
+    }
+    if (header.satType > static_cast<std::uint32_t>(SatType::UNKNOWN)) {
+        throw std::runtime_error{"The file " + filename + " contains the invalid satType "
+                                 + std::to_string(header.satType) + "!"};
+    }
+    if (header.size > _file.size()) {
+        throw std::runtime_error{"The columns of " + filename + " are truncated!"};
+    }
+    if (header.nameCount > Satellites::MAX_NAME_COUNT) {
+        throw std::runtime_error{"The name table of " + filename + " contains more than 256 names!"};
+    }
+    if (header.nameTableOffset > _file.size()) {
+        throw std::runtime_error{"The name table of " + filename + " is truncated!"};
+    }
+
+    _view.startId = header.startId;
+    _view.satType = static_cast<SatType>(header.satType);
+    _view.position = header.position;
+    _view.count = header.size;
+
+    size_t offset = header.nameTableOffset;
+    for (std::uint32_t i = 0; i < header.nameCount; ++i) {
+        std::uint64_t length;
+        if (sizeof(std::uint64_t) > _file.size() - offset) {
+            throw std::runtime_error{"The name table of " + filename + " is truncated!"};
+        }
+        std::memcpy(&length, _file.data() + offset, sizeof(std::uint64_t));
+        offset += sizeof(std::uint64_t);
+        if (length > _file.size() - offset) {
+            throw std::runtime_error{"The name table of " + filename + " is truncated!"};
+        }
+        _view.nameTable.push_back(std::make_shared<const std::string>(_file.data() + offset, length));
+        offset += length;
+    }
+
+    _view.parent = reinterpret_cast<const std::uint8_t *>(findColumn(header, "parent", ColumnType::UINT8, 1));
+    //Every parent index must refer to a name, so that the view can resolve the names without further checks
+    const std::uint8_t *parentEnd = _view.parent + _view.count;
+    const auto invalidParent = std::find_if(_view.parent, parentEnd, [this](std::uint8_t parentIndex) {
+        return parentIndex >= _view.nameTable.size();
+    });
+    if (invalidParent != parentEnd) {
+        throw std::runtime_error{"The parent index " + std::to_string(*invalidParent) + " of the Satellite at position "
+                                 + std::to_string(invalidParent - _view.parent) + " in " + filename
+                                 + " refers to no name!"};
+    }
+    _view.characteristicLength = reinterpret_cast<const double *>(
+            findColumn(header, "characteristicLength", ColumnType::FLOAT64, 1));
+    _view.areaToMassRatio = reinterpret_cast<const double *>(
+            findColumn(header, "areaToMassRatio", ColumnType::FLOAT64, 1));
+    _view.mass = reinterpret_cast<const double *>(findColumn(header, "mass", ColumnType::FLOAT64, 1));
+    _view.area = reinterpret_cast<const double *>(findColumn(header, "area", ColumnType::FLOAT64, 1));
+    _view.ejectionVelocity = reinterpret_cast<const std::array<double, 3> *>(
+            findColumn(header, "ejectionVelocity", ColumnType::FLOAT64, 3));
+    _view.velocity = reinterpret_cast<const std::array<double, 3> *>(
+            findColumn(header, "velocity", ColumnType::FLOAT64, 3));
+}
+
+const char *BinaryResultReader::findColumn(const util::binary::FileHeader &header, const std::string &name,
+                                           util::binary::ColumnType type, std::uint32_t components) const {
+    using namespace util::binary;
+    const size_t elementSize = type == ColumnType::FLOAT64 ? sizeof(double) : sizeof(std::uint8_t);
+    for (std::uint64_t i = 0; i < header.columnCount; ++i) {
+        ColumnEntry entry{};
+        std::memcpy(&entry, _file.data() + header.columnTableOffset + i * sizeof(ColumnEntry), sizeof(ColumnEntry));
+        entry.name.back() = '\0';
+        if (name != entry.name.data()) {
+            continue;
+        }
+        if (entry.type != type || entry.components != components
+            || entry.byteSize != header.size * components * elementSize) {
+            throw std::runtime_error{"The column " + name + " has an unexpected type or size!"};
+        }
+        if (entry.offset % alignof(double) != 0 || entry.offset > _file.size()
+            || entry.byteSize > _file.size() - entry.offset) {
+            throw std::runtime_error{"The column " + name + " is misaligned or truncated!"};
+        }
+        return _file.data() + entry.offset;
+    }
+    throw std::runtime_error{"The column " + name + " is missing!"};
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include "MappedFile.h"
+#include "breakupModel/model/SatellitesView.h"
+#include "breakupModel/util/UtilityBinary.h"
+
+/**
+ * Reads a file written by the BinaryWriter (the columnar binary format described in UtilityBinary.h).
+ * The file is memory mapped and the columns are accessed in place via a SatellitesView, so nothing is copied except
+ * the small name table. The view stays valid as long as this reader exists.
+ */
+class BinaryResultReader {
+
+    /**
+     * The mapped file
+     */
+    MappedFile _file;
+
+    SatellitesView _view;
+
+public:
+
+    /**
+     * Maps the given file and validates its header and columns.
+     * @param filename - path to a file written by the BinaryWriter
+     * @throws std::runtime_error if the file cannot be opened or is no valid result file (including an invalid satType
+     * or parent indices which refer to no name)
+     */
+    explicit BinaryResultReader(const std::string &filename);
+
+    /**
+     * Returns the view on the Satellites stored in the file.
+     * @return SatellitesView
+     */
+    const SatellitesView &getSatellites() const {
+        return _view;
+    }
+
+private:
+
+    /**
+     * Interprets the mapped bytes and sets up the view.
+     * @param filename - used for the error messages
+     */
+    void parse(const std::string &filename);
+
+    /**
+     * Returns the column with the given name after checking its type and size.
+     * @param header - the header of the file
+     * @param name - the name of the column
+     * @param type - the expected element type
+     * @param components - the expected number of elements per Satellite
+     * @return pointer to the first byte of the column
+     * @throws std::runtime_error if the column is missing or does not match
+     */
+    const char *findColumn(const util::binary::FileHeader &header, const std::string &name,
+                           util::binary::ColumnType type, std::uint32_t components) const;
+
+};
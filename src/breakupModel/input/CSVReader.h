@@ -2,26 +2,40 @@
 
 #include <utility>
 #include <array>
-#include <fstream>
+#include <vector>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <exception>
+#include <stdexcept>
 #include <tuple>
 #include <filesystem>
+#include <algorithm>
+#include <iterator>
+#include <execution>
+#include <charconv>
+#include <type_traits>
+#include "MappedFile.h"
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/util/UtilityZip.h"
 
 /**
  * Provides the functionality to read an CSV file into an container of tuples.
  * Every Type argument represents the type of a column. If the file has an header and the corresponding argument was set
  * to true in the constructor, the header can be read as strings by using getHeader().
+ * Optionally only a projection of the columns is read: then every Type argument belongs to the column of the file
+ * given in the constructor, the other columns are skipped without any conversion.
+ * The file is memory mapped and split at row boundaries into chunks which are parsed in parallel. Arithmetic cells are
+ * parsed with std::from_chars, strings are copied directly and all other types are read with their operator >>.
  *
  * @example CSVReader{int, std::string, double} reads in rows of the kind "1234,Hello World,3.33"
+ * @example CSVReader<std::string, double>{filepath, true, {0, 13}} reads only the first and the 14th column
  *
  * @note If you define the wrong types, the CSVReader will work nevertheless or not depending on the definition of the
  * operator >> for a given type. E. g. if you define double as type, but in the the CSV is written "word" in the
- * corresponding cell. The operator >> for double reads in zero. A reverse example would be defined type string, but
- * in the cell is written "12.22", then "12.22" will be the result. The CSVReader has no clue if the data is correct,
- * the checking is the obligation of the User.<br><br>
+ * corresponding cell. The CSVReader reads in zero (like the operator >> for double). A reverse example would be defined
+ * type string, but in the cell is written "12.22", then "12.22" will be the result. The CSVReader has no clue if the
+ * data is correct, the checking is the obligation of the User.<br><br>
  * Other example, where error handling is implemented: If you read in a SatType, the operator >> for SatType will throw
  * an exception if no mapping can be found. Nevertheless this is NOT implemented here in the CSVReader whereas it is
  * implemented by the "user".
@@ -33,20 +47,53 @@ class CSVReader {
 
     bool _hasHeader;
 
+    /**
+     * The columns of the file which are read, the i-th element of the tuple is read from the column _columns[i]
+     */
+    std::array<size_t, sizeof...(T)> _columns;
+
+    /**
+     * Maps every column of the file up to the last one which is read to its element in the tuple (-1: skipped)
+     */
+    std::vector<int> _elementOfColumn;
+
 public:
 
     /**
-     * Constructs a new CSV Reader.
+     * The approximate number of bytes parsed by one task
+     */
+    static constexpr size_t CHUNK_SIZE = 1u << 18u;
+
+    /**
+     * Constructs a new CSV Reader which reads all columns.
      * @param filepath
      * @param hasHeader
      * @throws an exception if the file does not exists
      */
     CSVReader(std::string filepath, bool hasHeader)
+            : CSVReader(std::move(filepath), hasHeader, allColumns(std::make_index_sequence<sizeof...(T)>{})) {}
+
+    /**
+     * Constructs a new CSV Reader which only reads the given columns.
+     * @param filepath
+     * @param hasHeader
+     * @param columns - the indices of the columns in the file (starting at zero) corresponding to the types
+     * @throws an exception if the file does not exists or if a column is given twice
+     */
+    CSVReader(std::string filepath, bool hasHeader, const std::array<size_t, sizeof...(T)> &columns)
             : _filepath(std::move(filepath)),
-              _hasHeader(hasHeader) {
+              _hasHeader(hasHeader),
+              _columns(columns) {
         if (!std::filesystem::exists(_filepath)) {
             throw std::runtime_error{"The CSV file " + _filepath + " does not exist!"};
         }
+        _elementOfColumn.assign(sizeof...(T) == 0 ? 0 : *std::max_element(_columns.begin(), _columns.end()) + 1, -1);
+        for (size_t i = 0; i < sizeof...(T); ++i) {
+            if (_elementOfColumn[_columns[i]] != -1) {
+                throw std::invalid_argument{"The CSVReader cannot read the same column twice!"};
+            }
+            _elementOfColumn[_columns[i]] = static_cast<int>(i);
+        }
     }
 
     ~CSVReader() = default;
@@ -54,69 +101,124 @@ public:
 
 private:
 
+    template<size_t... I>
+    static std::array<size_t, sizeof...(T)> allColumns(std::index_sequence<I...>) {
+        return {I...};
+    }
+
     /**
-     * Parses one cell of the CSV line file stream to a type V by using its >> operator.
-     * The getLine overhead fixes the problematic of ',' consumption.
+     * Parses one cell of a CSV row to an arithmetic type V by using std::from_chars.
+     * Like the operator >> an unparsable cell results in zero and trailing characters are ignored.
+     * @tparam V - the value to be extracted
+     * @param cell - the content of the cell
+     * @param value - the value extracted (non-const)
+     * @return true to not cause any issues in the fold expression
+     */
+    template<typename V>
+    static std::enable_if_t<std::is_arithmetic_v<V> && !std::is_same_v<V, bool>, bool>
+    parseCell(std::string_view cell, V &value) {
+        if (!cell.empty() && cell.front() == '+') {
+            cell.remove_prefix(1);
+        }
+        value = V{};
+        std::from_chars(cell.data(), cell.data() + cell.size(), value);
+        return true;
+    }
+
+    /**
+     * Parses one cell of a CSV row to a type V by using its >> operator.
      * @tparam V - the value to be extracted, should have an >> operator overload
-     * @param istream - the line stream
+     * @param cell - the content of the cell
      * @param value - the value extracted (non-const)
-     * @return true to not cause any issues in getTuple
+     * @return true to not cause any issues in the fold expression
      */
     template<typename V>
-    bool parseCell(std::istream &istream, V &value) const {
-        std::string cell;
-        std::getline(istream, cell, ',');
-        std::stringstream cellStream {cell};
+    static std::enable_if_t<!std::is_arithmetic_v<V> || std::is_same_v<V, bool>, bool>
+    parseCell(std::string_view cell, V &value) {
+        std::stringstream cellStream{std::string{cell}};
         cellStream.unsetf(std::ios_base::skipws);
         cellStream >> value;
         return true;
     }
 
     /**
-    * Parses one cell of the CSV line file stream to a type string. Fixes the problematic of whitespace
-    * consumption with the default >> operator for strings.
-    * @param istream - the line stream
+    * Parses one cell of a CSV row to a type string. The content is copied as it is.
+    * @param cell - the content of the cell
     * @param value - the value extracted (non-const)
-    * @return true to not cause any issues in getTuple
+    * @return true to not cause any issues in the fold expression
     */
-    bool parseCell(std::istream &istream, std::string &value) const {
-        std::string cell;
-        std::getline(istream, cell, ',');
-        value = cell;
+    static bool parseCell(std::string_view cell, std::string &value) {
+        value.assign(cell);
         return true;
     }
 
     /**
-     * Creates the tuple for a given lineStream.
-     * @tparam Tuple - the tuple to be filled
-     * @tparam I - index sequence (packed as long as parameter list T)
-     * @param lineStream - a CSV line/ row
-     * @param tuple the tuple to be filled
-     * @related For further information about this Idea. Code is adapted from here
-     * https://stackoverflow.com/questions/34314806/parsing-a-c-string-into-a-tuple [accessed 29.06.2021]
+     * Parses the cell into the element of the tuple given at runtime.
+     * @param element - the index of the tuple element
+     * @param cell - the content of the cell
+     * @param tuple - the tuple to be filled
      */
-    template<typename Tuple, typename std::size_t... I>
-    void getTuple(std::istream &lineStream, Tuple &tuple, std::index_sequence<I...>) const {
-      (parseCell(lineStream, std::get<I>(tuple)), ...);
+    template<typename Tuple, size_t... I>
+    static void parseElement(size_t element, std::string_view cell, Tuple &tuple, std::index_sequence<I...>) {
+        ((element == I && parseCell(cell, std::get<I>(tuple))), ...);
     }
 
     /**
-     * Returns the next line of the CSV file as a tuple
-     * @tparam Tuple - the tuple to be filled
-     * @param fileStream - the CSV input stream
+     * Fills the tuple with the projected cells of one row. Missing cells are parsed as empty cells.
+     * @param row - a CSV line/ row without line break
      * @param tuple - the tuple to be filled
-     * @return success of parsing a new element
      */
     template<typename Tuple>
-    bool nextLine(std::istream &fileStream, Tuple &tuple) const {
-        std::string line;
-        std::getline(fileStream, line);
-        if (!line.empty()) {
-            std::stringstream lineStream{line};
-            this->getTuple(lineStream, tuple, std::make_index_sequence<sizeof...(T)>{});
-            return true;
+    void parseRow(std::string_view row, Tuple &tuple) const {
+        size_t begin = 0;
+        for (int element : _elementOfColumn) {
+            std::string_view cell{};
+            if (begin <= row.size()) {
+                const size_t end = std::min(row.find(',', begin), row.size());
+                cell = row.substr(begin, end - begin);
+                begin = end + 1;
+            }
+            if (element >= 0) {
+                parseElement(static_cast<size_t>(element), cell, tuple, std::make_index_sequence<sizeof...(T)>{});
+            }
+        }
+    }
+
+    /**
+     * Returns the line starting at position without the line break.
+     * @param content - the text
+     * @param position - the beginning of the line, afterwards the beginning of the next line
+     * @return the line
+     */
+    static std::string_view nextLine(std::string_view content, size_t &position) {
+        const size_t end = std::min(content.find('\n', position), content.size());
+        std::string_view line = content.substr(position, end - position);
+        position = end + 1;
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    /**
+     * Returns the rows of the file: without the header and ending before the first empty line.
+     * @param content - the whole file
+     * @return the rows
+     */
+    std::string_view getRows(std::string_view content) const {
+        size_t position = 0;
+        if (_hasHeader) {
+            nextLine(content, position);
         }
-        return false;
+        std::string_view rows = content.substr(std::min(position, content.size()));
+        size_t end = 0;
+        while (end < rows.size()) {
+            const size_t lineBegin = end;
+            if (nextLine(rows, end).empty()) {
+                return rows.substr(0, lineBegin);
+            }
+        }
+        return rows;
     }
 
 public:
@@ -127,43 +229,71 @@ public:
      * @throws an exception if issues are encountered during parsing
      */
     std::vector<std::tuple<T...>> getLines() const {
-        //Open fileStream stream
-        std::ifstream fileStream{_filepath};
-        std::vector<std::tuple<T...>> lines{};
-        std::tuple<T...> t;
+        const MappedFile file{_filepath};
+        const std::string_view rows = getRows(file.view());
 
-        //Skip header if the fileStream has a header
-        if (_hasHeader) {
-            std::string line;
-            std::getline(fileStream, line);
+        //Split the rows into chunks of roughly CHUNK_SIZE bytes, each ending with a complete row
+        std::vector<std::string_view> chunks{};
+        size_t begin = 0;
+        while (begin < rows.size()) {
+            const size_t end = std::min(rows.find('\n', std::min(begin + CHUNK_SIZE, rows.size())), rows.size());
+            chunks.push_back(rows.substr(begin, end - begin + 1));
+            begin = end + 1;
         }
 
-        //Read row by row
-        while (this->nextLine(fileStream, t)) {
-            lines.push_back(t);
+        //Parse the chunks in parallel, exceptions are not allowed to leave the parallel algorithm
+        std::vector<std::vector<std::tuple<T...>>> chunkLines(chunks.size());
+        std::vector<std::exception_ptr> errors(chunks.size());
+        const auto chunkRange = util::indexRange(chunks.size());
+        std::for_each(std::execution::par, chunkRange.begin(), chunkRange.end(), [&](auto tuple) {
+            const size_t i = std::get<0>(tuple);
+            try {
+                std::tuple<T...> t{};
+                size_t position = 0;
+                while (position < chunks[i].size()) {
+                    this->parseRow(nextLine(chunks[i], position), t);
+                    chunkLines[i].push_back(t);
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (const auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
         }
 
+        std::vector<std::tuple<T...>> lines{};
+        size_t lineCount = 0;
+        for (const auto &part : chunkLines) {
+            lineCount += part.size();
+        }
+        lines.reserve(lineCount);
+        for (auto &part : chunkLines) {
+            std::move(part.begin(), part.end(), std::back_inserter(lines));
+        }
         return lines;
     }
 
     /**
-     * Returns the header of the CSV file as a vector of strings.
+     * Returns the header of the CSV file as a vector of strings (only the names of the read columns).
      * @return vector of strings
      * @throws an exception if the CSV file does not have an header
      */
     std::array<std::string, sizeof...(T)> getHeader() const {
         if (_hasHeader) {
+            const MappedFile file{_filepath};
+            size_t position = 0;
+            const std::string_view line = nextLine(file.view(), position);
             std::array<std::string, sizeof...(T)> header{};
-            std::ifstream fileStream{_filepath};
-            std::string line;
-            std::getline(fileStream, line);
-            std::stringstream lineStream{line};
-            std::string cell;
-
-            auto headerIt = header.begin();
-            while (std::getline(lineStream, cell, ',')) {
-                *headerIt = cell;
-                ++headerIt;
+            size_t begin = 0;
+            for (size_t column = 0; column < _elementOfColumn.size() && begin <= line.size(); ++column) {
+                const size_t end = std::min(line.find(',', begin), line.size());
+                if (_elementOfColumn[column] >= 0) {
+                    header[_elementOfColumn[column]] = std::string{line.substr(begin, end - begin)};
+                }
+                begin = end + 1;
             }
             return header;
         } else {
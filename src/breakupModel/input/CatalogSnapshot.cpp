@@ -0,0 +1,335 @@
+#include "CatalogSnapshot.h"
+
+#include <stdexcept>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <execution>
+#include <exception>
+#include <cstddef>
+#include "spdlog/spdlog.h"
+#include "breakupModel/util/UtilityZip.h"
+
+#ifndef _WIN32
+
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#else
+
+#include <process.h>
+
+#endif
+
+namespace {
+
+    /**
+     * Returns the canonical form of a path (used to compare the recorded and the given sources).
+     */
+    std::string canonicalPath(const std::string &path) {
+        std::error_code errorCode{};
+        auto canonical = std::filesystem::weakly_canonical(path, errorCode);
+        return errorCode ? path : canonical.string();
+    }
+
+    void writePadding(std::ofstream &file, std::size_t count) {
+        static const std::array<char, util::snapshot::ALIGNMENT> zeros{};
+        file.write(zeros.data(), static_cast<std::streamsize>(count));
+    }
+
+    /**
+     * Checks (without overflow) if count elements starting at offset fit into size bytes.
+     */
+    bool fitsInto(std::uint64_t offset, std::uint64_t count, std::uint64_t elementSize, std::uint64_t size) {
+        return offset <= size && count <= (size - offset) / elementSize;
+    }
+
+    /**
+     * Creates a new empty file next to the snapshot whose name is unique among all processes.
+     */
+    std::string createTemporaryFile(const std::string &snapshotFilename) {
+#ifndef _WIN32
+        std::string temporaryFilename = snapshotFilename + ".XXXXXX";
+        const int fd = ::mkstemp(temporaryFilename.data());
+        if (fd < 0) {
+            throw std::runtime_error{"A temporary file for " + snapshotFilename + " could not be created!"};
+        }
+        //mkstemp restricts the file to the owner, the snapshot should be readable like any other written file
+        ::fchmod(fd, 0644);
+        ::close(fd);
+        return temporaryFilename;
+#else
+        return snapshotFilename + "." + std::to_string(_getpid()) + ".tmp";
+#endif
+    }
+
+}
+
+std::vector<Satellite> CatalogSnapshot::getSatelliteCollection() const {
+    if (this->isUpToDate()) {
+        const MappedFile file{_snapshotFilename};
+        return readSatellites(file, *readHeader(file));
+    }
+
+    //The snapshot has to be rebuilt from the given or the recorded sources
+    std::pair<std::string, std::string> sources{};
+    if (_sources.has_value()) {
+        sources = *_sources;
+    } else {
+        std::vector<std::pair<std::string, util::snapshot::SourceEntry>> recorded{};
+        try {
+            const MappedFile file{_snapshotFilename};
+            const auto header = readHeader(file);
+            if (header.has_value()) {
+                recorded = readSources(file, *header);
+            }
+        } catch (std::exception &e) {
+            spdlog::debug("The catalog snapshot {} could not be read: {}", _snapshotFilename, e.what());
+        }
+        if (recorded.size() != 2) {
+            throw std::runtime_error{"The catalog snapshot " + _snapshotFilename +
+                                     " is invalid and there are no sources to rebuild it!"};
+        }
+        sources = std::make_pair(recorded[0].first, recorded[1].first);
+    }
+
+    spdlog::info("Building the catalog snapshot {} from {} and {}", _snapshotFilename, sources.first, sources.second);
+    TLESatcatDataReader tleSatcatDataReader{sources.first, sources.second};
+    auto satellites = tleSatcatDataReader.getSatelliteCollection();
+    try {
+        write(_snapshotFilename, satellites, {sources.first, sources.second});
+    } catch (std::exception &e) {
+        spdlog::warn("The catalog snapshot {} could not be written: {}", _snapshotFilename, e.what());
+    }
+    return satellites;
+}
+
+bool CatalogSnapshot::isUpToDate() const {
+    if (!std::filesystem::exists(_snapshotFilename)) {
+        return false;
+    }
+    try {
+        const MappedFile file{_snapshotFilename};
+        const auto header = readHeader(file);
+        if (!header.has_value()) {
+            return false;
+        }
+        const auto recorded = readSources(file, *header);
+        if (_sources.has_value() && (recorded.size() != 2
+                                     || recorded[0].first != canonicalPath(_sources->first)
+                                     || recorded[1].first != canonicalPath(_sources->second))) {
+            return false;
+        }
+        std::vector<std::pair<size_t, std::int64_t>> touchedSources{};
+        for (size_t i = 0; i < recorded.size(); ++i) {
+            const auto &[path, entry] = recorded[i];
+            if (!std::filesystem::exists(path)) {
+                //Without the sources the snapshot is the only catalog available (only possible if none was given)
+                if (_sources.has_value()) {
+                    return false;
+                }
+                continue;
+            }
+            //Only hash the file if the modification time differs (e.g. a copy or a touch with the same content)
+            const auto current = describeSource(path, false);
+            if (current.size != entry.size) {
+                return false;
+            } else if (current.modificationTime != entry.modificationTime) {
+                if (describeSource(path, true).hash != entry.hash) {
+                    return false;
+                }
+                touchedSources.emplace_back(i, current.modificationTime);
+            }
+        }
+        //The content is unchanged, record the new modification time so that the next load does not hash again
+        if (!touchedSources.empty()) {
+            updateModificationTimes(*header, touchedSources);
+        }
+        return true;
+    } catch (std::exception &e) {
+        return false;
+    }
+}
+
+void CatalogSnapshot::write(const std::string &snapshotFilename, const std::vector<Satellite> &satellites,
+                            const std::vector<std::string> &sources) {
+    using namespace util::snapshot;
+    std::string strings{};
+
+    std::vector<SourceEntry> sourceEntries{};
+    sourceEntries.reserve(sources.size());
+    for (const auto &source : sources) {
+        SourceEntry entry = describeSource(source, true);
+        const std::string path = canonicalPath(source);
+        entry.pathOffset = strings.size();
+        entry.pathLength = path.size();
+        strings += path;
+        sourceEntries.push_back(entry);
+    }
+
+    //The names are appended sequentially, the rest of the records is filled in parallel
+    std::vector<CatalogRecord> records(satellites.size());
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        const std::string &name = satellites[i].getName();
+        records[i].nameOffset = strings.size();
+        records[i].nameLength = static_cast<std::uint32_t>(name.size());
+        strings += name;
+    }
+    const auto recordRange = util::indexRange(satellites.size());
+    std::for_each(std::execution::par, recordRange.begin(), recordRange.end(), [&](auto tuple) {
+        const size_t i = std::get<0>(tuple);
+        const Satellite &satellite = satellites[i];
+        CatalogRecord &record = records[i];
+        const OrbitalElements orbitalElements = satellite.getOrbitalElements();
+        record.id = satellite.getId();
+        record.satType = static_cast<std::uint32_t>(satellite.getSatType());
+        record.characteristicLength = satellite.getCharacteristicLength();
+        record.areaToMassRatio = satellite.getAreaToMassRatio();
+        record.mass = satellite.getMass();
+        record.area = satellite.getArea();
+        record.orbitalElements = orbitalElements.getAsArray();
+        record.epochYear = orbitalElements.getEpoch().year;
+        record.epochFraction = orbitalElements.getEpoch().fraction;
+        record.position = satellite.getPosition();
+        record.velocity = satellite.getVelocity();
+    });
+
+    FileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.count = records.size();
+    header.sourceCount = sourceEntries.size();
+    header.sourceTableOffset = align(sizeof(FileHeader));
+    header.recordOffset = align(header.sourceTableOffset + sourceEntries.size() * sizeof(SourceEntry));
+    header.stringTableOffset = align(header.recordOffset + records.size() * sizeof(CatalogRecord));
+    header.stringTableSize = strings.size();
+
+    //Write into a temporary file first, so that a concurrent reader never sees a partial snapshot
+    //and two processes refreshing the same snapshot do not write into the same file
+    const std::string temporaryFilename = createTemporaryFile(snapshotFilename);
+    try {
+        std::ofstream file{temporaryFilename, std::ios::binary | std::ios::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error{"The file " + temporaryFilename + " could not be opened for writing!"};
+        }
+        file.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+        writePadding(file, header.sourceTableOffset - sizeof(FileHeader));
+        file.write(reinterpret_cast<const char *>(sourceEntries.data()),
+                   static_cast<std::streamsize>(sourceEntries.size() * sizeof(SourceEntry)));
+        writePadding(file, header.recordOffset - header.sourceTableOffset - sourceEntries.size() * sizeof(SourceEntry));
+        file.write(reinterpret_cast<const char *>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(CatalogRecord)));
+        writePadding(file, header.stringTableOffset - header.recordOffset - records.size() * sizeof(CatalogRecord));
+        file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+        if (!file) {
+            throw std::runtime_error{"The file " + temporaryFilename + " could not be written!"};
+        }
+        file.close();
+        std::filesystem::rename(temporaryFilename, snapshotFilename);
+    } catch (...) {
+        std::error_code errorCode{};
+        std::filesystem::remove(temporaryFilename, errorCode);
+        throw;
+    }
+}
+
+std::optional<util::snapshot::FileHeader> CatalogSnapshot::readHeader(const MappedFile &file) {
+    using namespace util::snapshot;
+    FileHeader header{};
+    if (file.size() < sizeof(FileHeader)) {
+        return std::nullopt;
+    }
+    std::memcpy(&header, file.data(), sizeof(FileHeader));
+    if (header.magic != MAGIC || header.version != VERSION || header.byteOrderMark != BYTE_ORDER_MARK) {
+        return std::nullopt;
+    }
+    if (!fitsInto(header.sourceTableOffset, header.sourceCount, sizeof(SourceEntry), file.size())
+        || header.recordOffset % alignof(CatalogRecord) != 0
+        || !fitsInto(header.recordOffset, header.count, sizeof(CatalogRecord), file.size())
+        || !fitsInto(header.stringTableOffset, header.stringTableSize, 1, file.size())) {
+        return std::nullopt;
+    }
+    return std::make_optional(header);
+}
+
+std::vector<std::pair<std::string, util::snapshot::SourceEntry>>
+CatalogSnapshot::readSources(const MappedFile &file, const util::snapshot::FileHeader &header) {
+    using namespace util::snapshot;
+    std::vector<std::pair<std::string, SourceEntry>> sources{};
+    for (std::uint64_t i = 0; i < header.sourceCount; ++i) {
+        SourceEntry entry{};
+        std::memcpy(&entry, file.data() + header.sourceTableOffset + i * sizeof(SourceEntry), sizeof(SourceEntry));
+        if (!fitsInto(entry.pathOffset, entry.pathLength, 1, header.stringTableSize)) {
+            throw std::runtime_error{"The source table of the catalog snapshot is corrupt!"};
+        }
+        sources.emplace_back(std::string{file.data() + header.stringTableOffset + entry.pathOffset, entry.pathLength},
+                             entry);
+    }
+    return sources;
+}
+
+util::snapshot::SourceEntry CatalogSnapshot::describeSource(const std::string &path, bool withHash) {
+    util::snapshot::SourceEntry entry{};
+    entry.size = std::filesystem::file_size(path);
+    entry.modificationTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::filesystem::last_write_time(path).time_since_epoch()).count();
+    if (withHash) {
+        const MappedFile file{path};
+        entry.hash = util::snapshot::hash(file.view());
+    }
+    return entry;
+}
+
+void CatalogSnapshot::updateModificationTimes(const util::snapshot::FileHeader &header,
+                                              const std::vector<std::pair<size_t, std::int64_t>> &sources) const {
+    using namespace util::snapshot;
+    try {
+        std::fstream file{_snapshotFilename, std::ios::binary | std::ios::in | std::ios::out};
+        for (const auto &[index, modificationTime] : sources) {
+            file.seekp(static_cast<std::streamoff>(header.sourceTableOffset + index * sizeof(SourceEntry)
+                                                   + offsetof(SourceEntry, modificationTime)));
+            file.write(reinterpret_cast<const char *>(&modificationTime), sizeof(std::int64_t));
+        }
+        if (!file) {
+            throw std::runtime_error{"The source table could not be written!"};
+        }
+    } catch (std::exception &e) {
+        spdlog::debug("The modification times of the catalog snapshot {} could not be updated: {}",
+                      _snapshotFilename, e.what());
+    }
+}
+
+std::vector<Satellite>
+CatalogSnapshot::readSatellites(const MappedFile &file, const util::snapshot::FileHeader &header) {
+    using namespace util::snapshot;
+    const auto *records = reinterpret_cast<const CatalogRecord *>(file.data() + header.recordOffset);
+    const char *strings = file.data() + header.stringTableOffset;
+
+    std::vector<Satellite> satellites(header.count);
+    std::vector<char> valid(header.count);
+    const auto recordRange = util::indexRange(header.count);
+    std::for_each(std::execution::par, recordRange.begin(), recordRange.end(), [&](auto tuple) {
+        const size_t i = std::get<0>(tuple);
+        const CatalogRecord &record = records[i];
+        valid[i] = fitsInto(record.nameOffset, record.nameLength, 1, header.stringTableSize)
+                   && record.satType <= static_cast<std::uint32_t>(SatType::UNKNOWN);
+        if (!valid[i]) {
+            return;
+        }
+        satellites[i] = Satellite{record.id,
+                                  std::make_shared<const std::string>(strings + record.nameOffset, record.nameLength),
+                                  static_cast<SatType>(record.satType), record.characteristicLength,
+                                  record.areaToMassRatio, record.mass, record.area, record.velocity, {},
+                                  record.position};
+        satellites[i].setCartesianWithOrbitalElements(
+                record.position, record.velocity,
+                OrbitalElements{record.orbitalElements, Epoch{record.epochYear, record.epochFraction}});
+    });
+    if (std::find(valid.begin(), valid.end(), false) != valid.end()) {
+        throw std::runtime_error{"The records of the catalog snapshot are corrupt!"};
+    }
+    return satellites;
+}
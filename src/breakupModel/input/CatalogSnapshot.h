@@ -0,0 +1,122 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include "DataSource.h"
+#include "MappedFile.h"
+#include "TLESatcatDataReader.h"
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/util/UtilitySnapshot.h"
+
+/**
+ * Reads the satellites from a catalog snapshot: a binary file containing the already joined catalog of a satcat.csv
+ * and a tle.txt (IDs, names, types, masses, orbital elements and cartesian state, see UtilitySnapshot.h).
+ * Loading a snapshot is a memory mapping, neither text parsing nor Kepler to cartesian conversion is required.<br>
+ * The snapshot records the size, modification time and content hash of its source files. If a source has changed
+ * (or the snapshot is missing or has another version), the catalog is rebuilt with the TLESatcatDataReader and the
+ * snapshot is written anew.
+ */
+class CatalogSnapshot : public DataSource {
+
+    /**
+     * The path to the snapshot file
+     */
+    const std::string _snapshotFilename;
+
+    /**
+     * The satcat.csv and tle.txt, if not given the sources recorded in the snapshot are used
+     */
+    const std::optional<std::pair<std::string, std::string>> _sources;
+
+public:
+
+    /**
+     * Creates a new Catalog Snapshot which is built from the sources recorded in the snapshot.
+     * If these sources do not exist anymore, the snapshot is used as it is.
+     * @param snapshotFilename - path to the snapshot
+     */
+    explicit CatalogSnapshot(std::string snapshotFilename)
+            : _snapshotFilename{std::move(snapshotFilename)},
+              _sources{std::nullopt} {}
+
+    /**
+     * Creates a new Catalog Snapshot for the given sources. The snapshot is (re-)built if it was built from other
+     * files or if the files have changed.
+     * @param snapshotFilename - path to the snapshot
+     * @param satcatFilename - path to the satcat.csv
+     * @param tleFilename - path to the tle.txt
+     */
+    CatalogSnapshot(std::string snapshotFilename, std::string satcatFilename, std::string tleFilename)
+            : _snapshotFilename{std::move(snapshotFilename)},
+              _sources{std::make_pair(std::move(satcatFilename), std::move(tleFilename))} {}
+
+    /**
+     * Returns the satellites of the snapshot. The snapshot is rebuilt before if it is not up to date.
+     * @return a Collection of Satellites
+     * @throws a runtime_error if the snapshot is invalid and cannot be rebuilt
+     */
+    std::vector<Satellite> getSatelliteCollection() const override;
+
+    /**
+     * Checks if the snapshot exists, has the current version and was built from the unchanged sources.
+     * @return true if the snapshot can be used as it is
+     */
+    bool isUpToDate() const;
+
+    /**
+     * Writes a snapshot of the given satellites.
+     * @param snapshotFilename - path to the snapshot
+     * @param satellites - the catalog
+     * @param sources - the files the catalog was built from
+     * @throws a runtime_error if the file cannot be written
+     */
+    static void write(const std::string &snapshotFilename, const std::vector<Satellite> &satellites,
+                      const std::vector<std::string> &sources);
+
+private:
+
+    /**
+     * Validates the header of the mapped snapshot.
+     * @param file - the mapped snapshot
+     * @return the header or std::nullopt if the file is no snapshot of the current version
+     */
+    static std::optional<util::snapshot::FileHeader> readHeader(const MappedFile &file);
+
+    /**
+     * Returns the source paths recorded in the snapshot together with their entries.
+     * @param file - the mapped snapshot
+     * @param header - its validated header
+     * @return vector of <path, entry>
+     */
+    static std::vector<std::pair<std::string, util::snapshot::SourceEntry>>
+    readSources(const MappedFile &file, const util::snapshot::FileHeader &header);
+
+    /**
+     * Describes a source file by its size, modification time and (optionally) content hash.
+     * @param path - the source file
+     * @param withHash - if false the hash is zero
+     * @return the entry (without path offset)
+     */
+    static util::snapshot::SourceEntry describeSource(const std::string &path, bool withHash);
+
+    /**
+     * Overwrites the recorded modification times of sources whose content is unchanged (best effort, a failure
+     * only means that the sources are hashed again on the next load).
+     * @param header - the validated header of the snapshot
+     * @param sources - vector of <index in the source table, new modification time>
+     */
+    void updateModificationTimes(const util::snapshot::FileHeader &header,
+                                 const std::vector<std::pair<size_t, std::int64_t>> &sources) const;
+
+    /**
+     * Creates the satellites from the records of the mapped snapshot.
+     * @param file - the mapped snapshot
+     * @param header - its validated header
+     * @return a Collection of Satellites
+     * @throws a runtime_error if a record has an invalid name or satellite type
+     */
+    static std::vector<Satellite> readSatellites(const MappedFile &file, const util::snapshot::FileHeader &header);
+
+};
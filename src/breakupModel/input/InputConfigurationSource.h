@@ -31,6 +31,23 @@ enum class SimulationType {
     UNKNOWN
 };
 
+/**
+ * Defines how the Breakup sweeps over the fragments.
+ */
+enum class ExecutionMode {
+    /**
+     * Every step of the simulation (L_c, A/M + area + mass, mass conservation, parents, delta velocity) is one
+     * sweep over all fragments.
+     */
+    STAGED,
+
+    /**
+     * L_c, A/M, area, mass and the ejection velocity are produced in one cache-blocked pass per block of fragments.
+     * The result is identical to STAGED for the same seed.
+     */
+    FUSED
+};
+
 /**
  * Pure virtual Interface for Control Input.
  * Provides methods to get config data, like minimal L_c, type of simulation, maximal given NORAD-ID or
@@ -47,6 +64,11 @@ public:
             {"EX",       SimulationType::EXPLOSION}
     };
 
+    inline const static std::map<std::string, ExecutionMode> stringToExecutionMode{
+            {"STAGED", ExecutionMode::STAGED},
+            {"FUSED",  ExecutionMode::FUSED}
+    };
+
     virtual ~InputConfigurationSource() = default;
 
     /**
@@ -89,4 +111,13 @@ public:
      */
     virtual bool getEnforceMassConservation() const = 0;
 
+    /**
+     * Returns how the simulation sweeps over the fragments. Both modes produce the same result for the same seed.
+     * Default implemented: STAGED
+     * @return ExecutionMode
+     */
+    virtual ExecutionMode getExecutionMode() const {
+        return ExecutionMode::STAGED;
+    }
+
 };
@@ -0,0 +1,55 @@
+#include "MappedFile.h"
+
+#include <stdexcept>
+#include <fstream>
+
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+MappedFile::MappedFile(const std::string &filename) {
+#ifndef _WIN32
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error{"The file " + filename + " could not be opened!"};
+    }
+    struct stat status{};
+    if (fstat(fd, &status) != 0) {
+        close(fd);
+        throw std::runtime_error{"The file " + filename + " cannot be read!"};
+    }
+    _size = static_cast<size_t>(status.st_size);
+    if (_size > 0) {
+        void *address = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error{"The file " + filename + " could not be mapped into memory!"};
+        }
+        _data = static_cast<const char *>(address);
+    }
+    close(fd);
+#else
+    std::ifstream file{filename, std::ios::binary | std::ios::ate};
+    if (!file.is_open()) {
+        throw std::runtime_error{"The file " + filename + " could not be opened!"};
+    }
+    _size = static_cast<size_t>(file.tellg());
+    _buffer = std::make_unique<double[]>(_size / sizeof(double) + 1);
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(_buffer.get()), static_cast<std::streamsize>(_size));
+    _data = reinterpret_cast<const char *>(_buffer.get());
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (_data != nullptr) {
+        munmap(const_cast<char *>(_data), _size);
+    }
+#endif
+}
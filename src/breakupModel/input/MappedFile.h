@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <memory>
+
+/**
+ * Read-only memory mapping of a whole file (RAII).
+ * The content can be accessed directly without copying it into a stream or string first.
+ * @note On platforms without mmap the file is read into a buffer instead. The beginning of the content is aligned
+ * to at least 8 bytes in both cases.
+ */
+class MappedFile {
+
+    /**
+     * The beginning of the content (nullptr for an empty file)
+     */
+    const char *_data{nullptr};
+
+    /**
+     * The length of the content in bytes
+     */
+    size_t _size{0};
+
+    /**
+     * The buffer holding the content if it is not memory mapped
+     */
+    std::unique_ptr<double[]> _buffer;
+
+public:
+
+    /**
+     * Maps the given file into memory.
+     * @param filename - path to the file
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string &filename);
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    /**
+     * Returns the beginning of the content.
+     * @return pointer to the first byte
+     */
+    [[nodiscard]] const char *data() const {
+        return _data;
+    }
+
+    /**
+     * Returns the length of the content.
+     * @return size in bytes
+     */
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    /**
+     * Returns the content as string_view.
+     * @return view of the whole file
+     */
+    [[nodiscard]] std::string_view view() const {
+        return std::string_view{_data, _size};
+    }
+
+};
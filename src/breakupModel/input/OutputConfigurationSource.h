@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <optional>
 #include "breakupModel/output/OutputWriter.h"
 
 /**
@@ -25,4 +26,11 @@ public:
     */
     virtual std::vector<std::shared_ptr<OutputWriter>> getInputTargets () const = 0;
 
+    /**
+     * Returns the number of fragments per block if the result should be streamed to the OutputTargets block by block
+     * instead of holding all fragments in memory.
+     * @return the block size or an empty optional if the result should not be streamed
+     */
+    virtual std::optional<size_t> getStreamingBlockSize() const = 0;
+
 };
\ No newline at end of file
@@ -1,5 +1,82 @@
 #include "TLEReader.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <execution>
+#include "MappedFile.h"
+#include "breakupModel/util/UtilityZip.h"
+
+namespace {
+
+    /**
+     * Parses the number in the columns [position, position + length) of a line like std::stod or std::stoul would
+     * do it with the substring, i.e. leading spaces are skipped and trailing characters are ignored.
+     * @tparam T - the type of the number
+     * @param line - the line
+     * @param position - the first column
+     * @param length - the maximal number of columns
+     * @param value - the parsed number
+     * @return true if a number was parsed
+     */
+    template<typename T>
+    bool parseField(std::string_view line, size_t position, size_t length, T &value) {
+        if (position >= line.size()) {
+            return false;
+        }
+        std::string_view field = line.substr(position, length);
+        while (!field.empty() && field.front() == ' ') {
+            field.remove_prefix(1);
+        }
+        if (!field.empty() && field.front() == '+') {
+            field.remove_prefix(1);
+        }
+        auto[end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+        return error == std::errc{};
+    }
+
+    /**
+     * Parses a TLE decimal field with assumed leading decimal point (e.g. the eccentricity "0006703" = 0.0006703)
+     * without building the string "0." + field.
+     * @return true if the field starts within the line
+     */
+    bool parseDecimalPointAssumed(std::string_view line, size_t position, size_t length, double &value) {
+        static constexpr std::array<double, 10> powersOfTen{1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+        if (position >= line.size()) {
+            return false;
+        }
+        const std::string_view field = line.substr(position, std::min<size_t>(length, powersOfTen.size() - 1));
+        std::uint64_t digits = 0;
+        auto[end, error] = std::from_chars(field.data(), field.data() + field.size(), digits);
+        if (error != std::errc{}) {
+            //Like "0." without any digits
+            value = 0.0;
+            return error == std::errc::invalid_argument;
+        }
+        //Both numbers are exact, so the division is rounded like the parsing of the decimal
+        value = static_cast<double>(digits) / powersOfTen[end - field.data()];
+        return true;
+    }
+
+    /**
+     * Returns the line starting at position without the line break.
+     * @param content - the whole file
+     * @param position - the beginning of the line, afterwards the beginning of the next line
+     * @return the line
+     */
+    std::string_view nextLine(std::string_view content, size_t &position) {
+        const char *begin = content.data() + position;
+        const auto *end = static_cast<const char *>(std::memchr(begin, '\n', content.size() - position));
+        size_t length = end == nullptr ? content.size() - position : static_cast<size_t>(end - begin);
+        position += end == nullptr ? length : length + 1;
+        if (length > 0 && begin[length - 1] == '\r') {
+            --length;
+        }
+        return std::string_view{begin, length};
+    }
+
+}
+
 const std::map<char, size_t> TLEReader::alpha5NumberingSchemeOffset{
         {' ', 0},
         {'0', 0},
@@ -40,69 +117,99 @@ const std::map<char, size_t> TLEReader::alpha5NumberingSchemeOffset{
 
 std::map<size_t, OrbitalElements> TLEReader::getMappingIDOrbitalElements() const {
     std::map<size_t, OrbitalElements> mapping{};
+    for (auto &pair : getSortedIDOrbitalElements()) {
+        mapping.emplace_hint(mapping.end(), pair);
+    }
+    return mapping;
+}
 
-    std::ifstream fileStream{_filepath};
-    std::string line;
-    std::string line1;
-    std::string line2;
+std::vector<std::pair<size_t, OrbitalElements>> TLEReader::getSortedIDOrbitalElements() const {
+    const MappedFile file{_filepath};
+    const std::string_view content = file.view();
 
+    //Split the file into the pairs of line 1 and line 2, other lines (e.g. names) are skipped
+    std::vector<std::pair<std::string_view, std::string_view>> entries{};
+    entries.reserve(content.size() / 140);
+    std::string_view line1{};
     bool line1Found = false;
-
-    while (std::getline(fileStream, line)) {
-        if (line.rfind('1', 0) == 0) {
+    size_t position = 0;
+    while (position < content.size()) {
+        const std::string_view line = nextLine(content, position);
+        if (!line.empty() && line.front() == '1') {
             line1 = line;
             line1Found = true;
-        } else if (line.rfind('2', 0) == 0 && line1Found) {
-            line2 = line;
-            auto pair = parseTLELines(line1, line2);
-            mapping.insert(pair);
+        } else if (!line.empty() && line.front() == '2' && line1Found) {
+            entries.emplace_back(line1, line);
             line1Found = false;
         }
     }
 
-    return mapping;
+    //Parse the entries in parallel into the pre-sized result
+    std::vector<std::pair<size_t, OrbitalElements>> result(entries.size());
+    std::vector<char> parsed(entries.size());
+    const auto entryRange = util::indexRange(entries.size());
+    std::for_each(std::execution::par, entryRange.begin(), entryRange.end(), [&](auto tuple) {
+        const size_t i = std::get<0>(tuple);
+        parsed[i] = parseTLELines(entries[i].first, entries[i].second, result[i]);
+    });
+    const auto malformed = std::find(parsed.begin(), parsed.end(), false);
+    if (malformed != parsed.end()) {
+        throw std::runtime_error{"The TLE file \"" + _filepath +
+                                 "\" is malformed! Some Data could not be parsed correctly into valid numbers!\n"
+                                 "The issue appeared in the following line:\n"
+                                 + std::string{entries[malformed - parsed.begin()].first}
+        };
+    }
+
+    //Sort by ID, the stable sort keeps the first of several entries with the same ID in front
+    std::stable_sort(std::execution::par, result.begin(), result.end(),
+                     [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+    result.erase(std::unique(result.begin(), result.end(),
+                             [](const auto &lhs, const auto &rhs) { return lhs.first == rhs.first; }),
+                 result.end());
+    return result;
 }
 
-std::pair<size_t, OrbitalElements> TLEReader::parseTLELines(const std::string &line1, const std::string &line2) const {
+bool TLEReader::parseTLELines(std::string_view line1, std::string_view line2,
+                              std::pair<size_t, OrbitalElements> &result) noexcept {
     size_t id;
     std::array<double, 6> tleData{};
     int year;
     double fraction;
 
-    try {
-        //ID
-        char firstCharOfID = line2.at(2);
-        std::string restID = line2.substr(3, 4);
-        id = std::stoul(restID);
-        id += alpha5NumberingSchemeOffset.at(firstCharOfID);
-        //Mean Motion [rev/day]
-        tleData[0] = std::stod(line2.substr(52, 11));
-        //Eccentricity
-        tleData[1] = std::stod("0." + line2.substr(26, 7));
-        //Inclination [deg]
-        tleData[2] = std::stod(line2.substr(8, 8));
-        //RAAN [deg]
-        tleData[3] = std::stod(line2.substr(17, 8));
-        //Argument of Perigee [deg]
-        tleData[4] = std::stod(line2.substr(34, 8));
-        //Mean Anomaly [deg]
-        tleData[5] = std::stod(line2.substr(43, 8));
-
-        //The year
-        year = std::stoi(line1.substr(18, 2));
-        year = year < 57 ? year + 2000 : year + 1900;
-        //The fraction of the year
-        fraction = std::stod(line1.substr(20, 8));
-
-    } catch (std::exception &e) {
-        throw std::runtime_error{"The TLE file \"" + _filepath +
-                                 "\" is malformed! Some Data could not be parsed correctly into valid numbers!\n"
-                                 "The issue appeared in the following line:\n"
-                                 + line1
-        };
+    //ID
+    if (line2.size() < 3) {
+        return false;
+    }
+    const auto offset = alpha5NumberingSchemeOffset.find(line2[2]);
+    if (offset == alpha5NumberingSchemeOffset.end() || !parseField(line2, 3, 4, id)) {
+        return false;
+    }
+    id += offset->second;
+    const bool success =
+            //Mean Motion [rev/day]
+            parseField(line2, 52, 11, tleData[0])
+            //Eccentricity
+            && parseDecimalPointAssumed(line2, 26, 7, tleData[1])
+            //Inclination [deg]
+            && parseField(line2, 8, 8, tleData[2])
+            //RAAN [deg]
+            && parseField(line2, 17, 8, tleData[3])
+            //Argument of Perigee [deg]
+            && parseField(line2, 34, 8, tleData[4])
+            //Mean Anomaly [deg]
+            && parseField(line2, 43, 8, tleData[5])
+            //The year
+            && parseField(line1, 18, 2, year)
+            //The fraction of the year
+            && parseField(line1, 20, 8, fraction);
+    if (!success) {
+        return false;
     }
+    year = year < 57 ? year + 2000 : year + 1900;
 
     OrbitalElementsFactory factory{};
     Epoch epoch{year, fraction};
-    return std::make_pair(id, factory.createFromTLEData(tleData, epoch));
+    result = std::make_pair(id, factory.createFromTLEData(tleData, epoch));
+    return true;
 }
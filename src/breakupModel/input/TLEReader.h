@@ -3,14 +3,15 @@
 #include <utility>
 #include <array>
 #include <map>
+#include <vector>
 #include <string>
-#include <sstream>
-#include <fstream>
+#include <string_view>
 #include <filesystem>
 #include "breakupModel/model/OrbitalElementsFactory.h"
 
 /**
  * Provides the functionality to parse a TLE (Two-Line-Format) with the Alpha-5 scheme.
+ * The file is memory mapped and split into pairs of lines, which are then parsed in parallel with std::from_chars.
  * @note The TLE reader ONLY extracts arguments used by the simulation the rest is "thrown away". This behavior can be
  * modified if wished.
  */
@@ -51,15 +52,28 @@ public:
      */
     std::map<size_t, OrbitalElements> getMappingIDOrbitalElements() const;
 
+    /**
+     * Returns the pairs of satellite ID and Keplerian Elements as read from the TLE file in a flat vector sorted by
+     * the ID. If an ID appears multiple times, the first entry in the file is kept (like in the mapping).
+     * Use this instead of getMappingIDOrbitalElements() to avoid building the tree of a std::map, the Elements of an
+     * ID can be found with a binary search.
+     * @return vector of ID and KeplerElements sorted by ID
+     * @throws an exception if the TLE is malformed or any other issues are encountered during the parsing
+     */
+    std::vector<std::pair<size_t, OrbitalElements>> getSortedIDOrbitalElements() const;
+
 private:
 
     /**
-     * Parses the line two of an TLE entry to a pair of ID and Kepler elements.
-     * @param line1 - the input stream
-     * @return a pair of ID and KeplerElements
-     * @throws an exception if the TLE is malformed or any other issues are encountered during the parsing
+     * Parses the lines one and two of an TLE entry to a pair of ID and Kepler elements.
+     * This method does not throw, so it can be called from a parallel algorithm.
+     * @param line1 - the first line of the entry
+     * @param line2 - the second line of the entry
+     * @param result - the pair of ID and KeplerElements
+     * @return true if the entry could be parsed, false if it is malformed
      */
-    std::pair<size_t, OrbitalElements> parseTLELines(const std::string &line1, const std::string &line2) const;
+    static bool parseTLELines(std::string_view line1, std::string_view line2,
+                              std::pair<size_t, OrbitalElements> &result) noexcept;
 
 };
 
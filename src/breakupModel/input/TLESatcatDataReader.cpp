@@ -1,44 +1,63 @@
 #include "TLESatcatDataReader.h"
 
 std::vector<Satellite> TLESatcatDataReader::getSatelliteCollection() const {
-    std::vector<Satellite> satellites{};
-    SatelliteBuilder satelliteBuilder{};
+    const auto satcat = this->getSortedSatcat();
+    const auto tle = _tleReader.getSortedIDOrbitalElements();
 
-    auto mappingSatcat = this->getSatcatMapping();
-    auto mappingTLE = _tleReader.getMappingIDOrbitalElements();
-
-    satellites.reserve(std::max(mappingSatcat.size(), mappingTLE.size()));
-
-    //We just search for satellites which appear in both mappings
+    //We just search for satellites which appear in both sources
     // --> No missing data possible (but not necessarily wrong information
-    for (auto const& [id, orbitalElements] : mappingTLE) {
-        if (mappingSatcat.count(id) != 0) {
-            auto &dataSatcat = mappingSatcat[id];
-            satellites.push_back(
-                    satelliteBuilder
-                            .reset()
-                            .setID(id)
-                            .setName(std::get<0>(dataSatcat))
-                            .setSatType(std::get<1>(dataSatcat))
-                            .setMassByArea(std::get<2>(dataSatcat))
-                            .setOrbitalElements(orbitalElements)
-                            .getResult()
-            );
+    //Both are sorted by ID and unique, so a merge join finds the pairs (index TLE, index satcat)
+    std::vector<std::pair<size_t, size_t>> matches{};
+    matches.reserve(std::min(satcat.size(), tle.size()));
+    auto satcatIt = satcat.begin();
+    for (size_t i = 0; i < tle.size() && satcatIt != satcat.end(); ++i) {
+        satcatIt = std::lower_bound(satcatIt, satcat.end(), tle[i].first, [](const auto &entry, size_t id) {
+            return std::get<1>(entry) < id;
+        });
+        if (satcatIt != satcat.end() && std::get<1>(*satcatIt) == tle[i].first) {
+            matches.emplace_back(i, satcatIt - satcat.begin());
+        }
+    }
+
+    //Build the satellites in parallel (the orbital elements are converted to cartesian coordinates)
+    std::vector<Satellite> satellites(matches.size());
+    std::vector<std::exception_ptr> errors(matches.size());
+    const auto matchRange = util::indexRange(matches.size());
+    std::for_each(std::execution::par, matchRange.begin(), matchRange.end(), [&](auto tuple) {
+        const size_t i = std::get<0>(tuple);
+        const auto &[id, orbitalElements] = tle[matches[i].first];
+        const auto &[name, satcatId, type, rcs] = satcat[matches[i].second];
+        try {
+            SatelliteBuilder satelliteBuilder{};
+            satellites[i] = satelliteBuilder
+                    .setID(id)
+                    .setName(name)
+                    .setSatType(type)
+                    .setMassByArea(rcs)
+                    .setOrbitalElements(orbitalElements)
+                    .getResult();
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
         }
     }
     return satellites;
 }
 
-std::map<size_t, std::tuple<std::string, SatType, double>> TLESatcatDataReader::getSatcatMapping() const {
-    std::map<size_t, std::tuple<std::string, SatType, double>> mapping{};
-
-    //If the mapping should contain more infos --> Here's the code to change that
+std::vector<std::tuple<std::string, size_t, SatType, double>> TLESatcatDataReader::getSortedSatcat() const {
     auto satcat = _satcatReader.getLines();
-    for (auto const& [name, identifier, id, type, statusCode, owner, launchDate, launchSite, decayDate, period,
-                      inclination, apogee, perigee, rcs, dataStatusCode, orbitCenter, OrbitType] : satcat) {
 
-        mapping.insert(std::make_pair(id, std::make_tuple(name, type, rcs)));
-    }
+    //Sort by ID, the stable sort keeps the first of several entries with the same ID in front
+    std::stable_sort(std::execution::par, satcat.begin(), satcat.end(), [](const auto &lhs, const auto &rhs) {
+        return std::get<1>(lhs) < std::get<1>(rhs);
+    });
+    satcat.erase(std::unique(satcat.begin(), satcat.end(), [](const auto &lhs, const auto &rhs) {
+        return std::get<1>(lhs) == std::get<1>(rhs);
+    }), satcat.end());
 
-    return mapping;
+    return satcat;
 }
@@ -1,7 +1,11 @@
 #pragma once
 
 #include <string>
-#include <map>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <execution>
+#include <exception>
 #include <tuple>
 #include <cmath>
 #include "DataSource.h"
@@ -9,6 +13,7 @@
 #include "TLEReader.h"
 #include "breakupModel/model/Satellite.h"
 #include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/util/UtilityZip.h"
 
 /**
  * Class which reads data from a tle.txt and a satcat.csv
@@ -23,11 +28,11 @@ class TLESatcatDataReader : public DataSource {
      * Otherwise these are all the fields available (in order of appearance):<br>
      * name, identifier, id, type, statusCode, owner, launchDate, launchSite, decayDate, period,
      * inclination, apogee, perigee, rcs, dataStatusCode, orbitCenter, OrbitType
+     * <br><br>
+     * Only the important fields are read, the other columns are skipped (see SATCAT_COLUMNS).
+     * If the mapping should contain more infos --> Here's the code to change that
      */
-    CSVReader<std::string, std::string, size_t,
-            SatType, std::string, std::string, std::string, std::string, std::string,
-            double, double, double, double, double,
-            std::string, std::string, std::string> _satcatReader;
+    CSVReader<std::string, size_t, SatType, double> _satcatReader;
 
     /**
      * Delegation to read the tle.txt
@@ -36,6 +41,11 @@ class TLESatcatDataReader : public DataSource {
 
 public:
 
+    /**
+     * The indices of the columns name, id, type and rcs in a satcat.csv
+     */
+    static constexpr std::array<size_t, 4> SATCAT_COLUMNS{0, 2, 3, 13};
+
     /**
      * Creates a new TLE Satcat Data Reader.
      * @param satcatFilename
@@ -43,26 +53,24 @@ public:
      * @throws if one file does not exists this constructor will "rethrow" the exception
      */
     TLESatcatDataReader(const std::string &satcatFilename, const std::string &telFilename)
-            : _satcatReader{satcatFilename, true},
+            : _satcatReader{satcatFilename, true, SATCAT_COLUMNS},
               _tleReader(telFilename) {}
 
     /**
      * Creates a new TLE Satcat Data Reader.
-     * @param satcatFilename
-     * @param telFilename
-     * @throws if one file does not exists this constructor will "rethrow" the exception
+     * @param csvReader - reader of the columns name, id, type and rcs of a satcat.csv
+     * @param tleReader
      */
-    TLESatcatDataReader(const CSVReader<std::string, std::string, size_t,
-            SatType, std::string, std::string, std::string, std::string, std::string,
-            double, double, double, double, double,
-            std::string, std::string, std::string> &csvReader, const TLEReader &tleReader)
+    TLESatcatDataReader(const CSVReader<std::string, size_t, SatType, double> &csvReader,
+                        const TLEReader &tleReader)
             : _satcatReader{csvReader},
               _tleReader{tleReader} {}
 
     /**
      * Returns the a SatelliteCollection by reading the given satcat.csv and TLE data.
      * Neither of the two of them contains all necessary information. So this method also merges the information
-     * by using the unique ID of each satellite.
+     * by using the unique ID of each satellite (merge join of both sources sorted by ID). The satellites are built
+     * in parallel and are returned in order of their ID.
      * @return a Collection of Satellites
      * @throws a runtime_error if satcat or tle is corrupt
      */
@@ -71,11 +79,12 @@ public:
 private:
 
     /**
-     * Returns a mapping of satellites ID to its name, type and Radar Cross Section (RCS) in [m^2]
-     * @return mapping <ID, infos>
+     * Returns the name, ID, type and Radar Cross Section (RCS) in [m^2] of the satellites in the satcat.csv sorted by
+     * their ID. If an ID appears multiple times, the first entry is kept.
+     * @return vector of <name, ID, type, RCS>
      * @throws a runtime_error if satcat is corrupt
      */
-    std::map<size_t, std::tuple<std::string, SatType, double>> getSatcatMapping() const;
+    std::vector<std::tuple<std::string, size_t, SatType, double>> getSortedSatcat() const;
 
 };
 
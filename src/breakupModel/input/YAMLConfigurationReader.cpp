@@ -41,6 +41,24 @@ std::shared_ptr<const DataSource> YAMLConfigurationReader::getDataReader() const
             fileNames.push_back(inputSource.as<std::string>());
         }
     }
+    return createDataReader(fileNames);
+}
+
+std::shared_ptr<const DataSource> YAMLConfigurationReader::createDataReader(const std::vector<std::string> &fileNames) {
+    //fileName.snapshot alone or together with the files it is built from (satcat.csv and tle.txt in any order)
+    const auto isSnapshot = [](const std::string &fileName) {
+        return fileName.size() >= 9 && fileName.substr(fileName.size() - 9) == ".snapshot";
+    };
+    const auto snapshot = std::find_if(fileNames.begin(), fileNames.end(), isSnapshot);
+    if (snapshot != fileNames.end() && fileNames.size() == 1) {
+        return std::make_shared<CatalogSnapshot>(fileNames[0]);
+    } else if (snapshot != fileNames.end() && fileNames.size() == 3) {
+        std::vector<std::string> sources{};
+        std::copy_if(fileNames.begin(), fileNames.end(), std::back_inserter(sources),
+                     [&isSnapshot](const std::string &fileName) { return !isSnapshot(fileName); });
+        const bool satcatFirst = sources[0].size() >= 4 && sources[0].substr(sources[0].size() - 4) == ".csv";
+        return std::make_shared<CatalogSnapshot>(*snapshot, sources[satcatFirst ? 0 : 1], sources[satcatFirst ? 1 : 0]);
+    }
 
     //fileName.yaml
     if (fileNames.size() == 1 && fileNames[0].find(".yaml")) {
@@ -83,6 +101,75 @@ bool YAMLConfigurationReader::getEnforceMassConservation() const {
     }
 }
 
+ExecutionMode YAMLConfigurationReader::getExecutionMode() const {
+    if (_file[SIMULATION_TAG][EXECUTION_MODE_TAG]) {
+        const auto mode = _file[SIMULATION_TAG][EXECUTION_MODE_TAG].as<std::string>();
+        const auto it = InputConfigurationSource::stringToExecutionMode.find(mode);
+        if (it == InputConfigurationSource::stringToExecutionMode.end()) {
+            throw std::runtime_error{"The execution mode " + mode + " is unknown! Use STAGED or FUSED."};
+        }
+        return it->second;
+    } else {
+        return ExecutionMode::STAGED;
+    }
+}
+
+std::optional<size_t> YAMLConfigurationReader::getRealizationCount() const {
+    if (_file[SIMULATION_TAG][REALIZATIONS_TAG]) {
+        return std::make_optional(_file[SIMULATION_TAG][REALIZATIONS_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::uint64_t> YAMLConfigurationReader::getSeed() const {
+    if (_file[SIMULATION_TAG][SEED_TAG]) {
+        return std::make_optional(_file[SIMULATION_TAG][SEED_TAG].as<std::uint64_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<size_t> YAMLConfigurationReader::getStreamingBlockSize() const {
+    if (_file[RESULT_OUTPUT_TAG] && _file[RESULT_OUTPUT_TAG][STREAMING_TAG]) {
+        return std::make_optional(_file[RESULT_OUTPUT_TAG][STREAMING_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::vector<std::shared_ptr<FragmentSink>> YAMLConfigurationReader::getStreamingTargets() const {
+    std::vector<std::shared_ptr<FragmentSink>> sinks{};
+    if (!_file[RESULT_OUTPUT_TAG]) {
+        return sinks;
+    }
+    //Checked before the writers are created, which would already truncate the other targets
+    for (const auto &target : _file[RESULT_OUTPUT_TAG][TARGET_TAG]) {
+        const auto filename = target.as<std::string>();
+        if (filename.size() >= 3 && filename.substr(filename.size() - 3) == "bin") {
+            throw std::runtime_error{"The result target " + filename + " cannot be written in the streaming mode! "
+                                     "Remove the target or the streaming option."};
+        }
+    }
+    for (auto &out : extractOutputWriter(_file[RESULT_OUTPUT_TAG])) {
+        auto sink = std::dynamic_pointer_cast<FragmentSink>(out);
+        if (!sink) {
+            throw std::runtime_error{"A result target cannot be written in the streaming mode! "
+                                     "Remove the target or the streaming option."};
+        }
+        sinks.push_back(sink);
+    }
+    return sinks;
+}
+
+std::optional<std::string> YAMLConfigurationReader::getStatisticsTarget() const {
+    if (_file[RESULT_OUTPUT_TAG] && _file[RESULT_OUTPUT_TAG][STATISTICS_TAG]) {
+        return std::make_optional(_file[RESULT_OUTPUT_TAG][STATISTICS_TAG].as<std::string>());
+    } else {
+        return std::nullopt;
+    }
+}
+
 std::vector<std::shared_ptr<OutputWriter>> YAMLConfigurationReader::getOutputTargets() const {
     if (_file[RESULT_OUTPUT_TAG]) {
         return extractOutputWriter(_file[RESULT_OUTPUT_TAG]);
@@ -92,6 +179,15 @@ std::vector<std::shared_ptr<OutputWriter>> YAMLConfigurationReader::getOutputTar
     return std::vector<std::shared_ptr<OutputWriter>>{};
 }
 
+std::vector<std::shared_ptr<OutputWriter>> YAMLConfigurationReader::getOutputTargets(
+        const std::string &fileSuffix) const {
+    //An ensemble may only write its statistics, then the single realizations are not written at all
+    if (_file[RESULT_OUTPUT_TAG] && (_file[RESULT_OUTPUT_TAG][TARGET_TAG] || !_file[RESULT_OUTPUT_TAG][STATISTICS_TAG])) {
+        return extractOutputWriter(_file[RESULT_OUTPUT_TAG], fileSuffix);
+    }
+    return std::vector<std::shared_ptr<OutputWriter>>{};
+}
+
 std::vector<std::shared_ptr<OutputWriter>> YAMLConfigurationReader::getInputTargets() const {
     std::vector<std::shared_ptr<OutputWriter>> outputs{};
     if (_file[INPUT_OUTPUT_TAG]) {
@@ -101,7 +197,7 @@ std::vector<std::shared_ptr<OutputWriter>> YAMLConfigurationReader::getInputTarg
 }
 
 std::vector<std::shared_ptr<OutputWriter>>
-YAMLConfigurationReader::extractOutputWriter(const YAML::Node &node) {
+YAMLConfigurationReader::extractOutputWriter(const YAML::Node &node, const std::string &fileSuffix) {
     //If no targets are given, we can save a lot of work
     if (!node[TARGET_TAG]) {
         throw std::runtime_error{"You specified an output tag, but did not give it any targets!"};
@@ -110,6 +206,10 @@ YAMLConfigurationReader::extractOutputWriter(const YAML::Node &node) {
     std::vector<std::shared_ptr<OutputWriter>> outputs{};
     for (auto outputFile : node[TARGET_TAG]) {
         std::string filename{outputFile.as<std::string>()};
+        if (!fileSuffix.empty()) {
+            const size_t extension = filename.rfind('.');
+            filename.insert(extension == std::string::npos ? filename.size() : extension, fileSuffix);
+        }
         if (filename.substr(filename.size() - 3) == "csv") {            //CSV Case
             if (node[CSV_PATTERN_TAG]) {
                 auto pattern = node[CSV_PATTERN_TAG].as<std::string>();
@@ -122,9 +222,22 @@ YAMLConfigurationReader::extractOutputWriter(const YAML::Node &node) {
                 outputs.push_back(std::shared_ptr<OutputWriter>(new CSVWriter(filename, kepler)));
             }
         } else if (filename.substr(filename.size() - 3) == "vtu") {     //VTK Case
-            outputs.push_back(std::shared_ptr<OutputWriter>(new VTKWriter(filename)));
+            VTKFormat format = VTKFormat::ASCII;
+            if (node[VTK_FORMAT_TAG]) {
+                format = VTKWriter::stringToVTKFormat.at(node[VTK_FORMAT_TAG].as<std::string>());
+            }
+            size_t pieces = 1;
+            if (node[VTK_PIECES_TAG]) {
+                pieces = node[VTK_PIECES_TAG].as<size_t>();
+            }
+            outputs.push_back(std::shared_ptr<OutputWriter>(new VTKWriter(filename, format, pieces)));
+        } else if (filename.substr(filename.size() - 3) == "bin") {     //Columnar binary Case
+            outputs.push_back(std::shared_ptr<OutputWriter>(new BinaryWriter(filename)));
+        } else if (filename.size() >= 5 && filename.substr(filename.size() - 5) == "arrow") {  //Arrow IPC Case
+            outputs.push_back(std::shared_ptr<OutputWriter>(new ArrowWriter(filename)));
         } else {
-            spdlog::warn("The file {} is no available output form. Available are csv and vtu Output", filename);
+            spdlog::warn("The file {} is no available output form. Available are csv, vtu, bin and arrow Output",
+                         filename);
         }
     }
     //Lastly check, if we really extracted OutputWriter
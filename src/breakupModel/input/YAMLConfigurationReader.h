@@ -2,13 +2,21 @@
 
 #include <utility>
 #include <exception>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
 #include "InputConfigurationSource.h"
 #include "OutputConfigurationSource.h"
 #include "YAMLDataReader.h"
 #include "TLESatcatDataReader.h"
+#include "CatalogSnapshot.h"
 #include "breakupModel/output/CSVWriter.h"
 #include "breakupModel/output/CSVPatternWriter.h"
 #include "breakupModel/output/VTKWriter.h"
+#include "breakupModel/output/BinaryWriter.h"
+#include "breakupModel/output/ArrowWriter.h"
+#include "breakupModel/output/FragmentSink.h"
 #include "spdlog/spdlog.h"
 
 /**
@@ -27,11 +35,18 @@ class YAMLConfigurationReader : public InputConfigurationSource, public OutputCo
     static constexpr char INPUT_SOURCE_TAG[] = "inputSource";
     static constexpr char ID_FILTER_TAG[] = "idFilter";
     static constexpr char ENFORCE_MASS_CONSERVATION_TAG[] = "enforceMassConservation";
+    static constexpr char EXECUTION_MODE_TAG[] = "executionMode";
+    static constexpr char REALIZATIONS_TAG[] = "realizations";
+    static constexpr char SEED_TAG[] = "seed";
     static constexpr char RESULT_OUTPUT_TAG[] = "resultOutput";
     static constexpr char INPUT_OUTPUT_TAG[] = "inputOutput";
     static constexpr char TARGET_TAG[] = "target";
     static constexpr char KEPLER_TAG[] = "kepler";
     static constexpr char CSV_PATTERN_TAG[] = "csvPattern";
+    static constexpr char VTK_FORMAT_TAG[] = "vtkFormat";
+    static constexpr char VTK_PIECES_TAG[] = "vtkPieces";
+    static constexpr char STREAMING_TAG[] = "streaming";
+    static constexpr char STATISTICS_TAG[] = "statistics";
 
     const YAML::Node _file;
 
@@ -61,6 +76,18 @@ public:
         }
     }
 
+    /**
+     * Creates a new YAML Configuration Reader from an already loaded YAML Node (e.g. an event of a scenario).
+     * @param node - the root of the configuration
+     * @throws an exception if no SIMULATION_TAG is found
+     */
+    explicit YAMLConfigurationReader(YAML::Node node)
+            : _file{std::move(node)} {
+        if (!_file[SIMULATION_TAG]) {
+            throw std::runtime_error{"No tag found the YAML-Config file which specifies the simulation!"};
+        }
+    }
+
 
     /**
      * Returns the minimal characteristic Length for fragments later created by the Breakup Simulation.
@@ -91,6 +118,14 @@ public:
      */
     std::shared_ptr<const DataSource> getDataReader() const override;
 
+    /**
+     * Returns the DataSource for the given list of input files (the value of the inputSource tag).
+     * @param fileNames - either a data.yaml, a satcat.csv and a tle.txt or a catalog snapshot with or without them
+     * @return DataSource as shared pointer
+     * @throws a runtime_error if the files are no valid input
+     */
+    static std::shared_ptr<const DataSource> createDataReader(const std::vector<std::string> &fileNames);
+
     /**
      * Returns the ID selection for the filter if given. Else an empty optional is returned.
      * @return filter or empty
@@ -104,25 +139,75 @@ public:
      */
     bool getEnforceMassConservation() const override;
 
+    /**
+     * Returns how the simulation sweeps over the fragments (STAGED or FUSED).
+     * @return the given ExecutionMode, otherwise STAGED
+     * @throws a runtime_error if the mode is given but unknown
+     */
+    ExecutionMode getExecutionMode() const override;
+
+    /**
+     * Returns the number of realizations if the simulation should be run as Monte Carlo ensemble.
+     * @return number of realizations or empty
+     */
+    std::optional<size_t> getRealizationCount() const;
+
+    /**
+     * Returns the seed of the simulation (the base seed in case of an ensemble) if given.
+     * @return seed or empty
+     */
+    std::optional<std::uint64_t> getSeed() const;
+
     /**
      * Reads in which Output is wished by the YAML file.
      * @return a vector containing the Outputs according to the YAML file
      */
     std::vector<std::shared_ptr<OutputWriter>> getOutputTargets() const override;
 
+    /**
+     * Reads in which Output is wished by the YAML file. The suffix is inserted into every target filename before its
+     * extension, e.g. "result.csv" with suffix "_7" becomes "result_7.csv".
+     * This is useful to write the results of the realizations of an ensemble into different files.
+     * In contrast to getOutputTargets() no targets are required if a statistics target is given instead.
+     * @param fileSuffix - the suffix
+     * @return a vector containing the Outputs according to the YAML file
+     */
+    std::vector<std::shared_ptr<OutputWriter>> getOutputTargets(const std::string &fileSuffix) const;
+
     /**
      * Reads in which Output is wished for the Input Satellites.
      * @return a vector containing the Outputs according to the YAML file
      */
     std::vector<std::shared_ptr<OutputWriter>> getInputTargets() const override;
 
+    /**
+     * Returns the block size for streaming the result if given in the result output specification.
+     * @return block size or empty
+     */
+    std::optional<size_t> getStreamingBlockSize() const override;
+
+    /**
+     * Returns the targets of the result as FragmentSinks for a streamed simulation.
+     * @return a vector containing the Outputs according to the YAML file
+     * @throws a runtime_error if a target cannot consume the fragments block by block (e.g. a .bin file)
+     */
+    std::vector<std::shared_ptr<FragmentSink>> getStreamingTargets() const;
+
+    /**
+     * Returns the filename for the aggregated statistics of an ensemble if given in the result output specification.
+     * @return filename or empty
+     */
+    std::optional<std::string> getStatisticsTarget() const;
+
 private:
 
     /**
      * Internally used by getOutputTargets() and getInputTargets() to read in the YAML output specification.
      * @param node - the YAML Node RESULT_OUTPUT_TAG or either INPUT_OUTPUT_TAG
+     * @param fileSuffix - inserted into every filename before its extension (default: none)
      * @return a vector containing the OutputWriter according to the YAML file
      */
-    static std::vector<std::shared_ptr<OutputWriter>> extractOutputWriter(const YAML::Node &node) ;
+    static std::vector<std::shared_ptr<OutputWriter>> extractOutputWriter(const YAML::Node &node,
+                                                                          const std::string &fileSuffix = "");
 };
 
@@ -1,5 +1,8 @@
 #include "YAMLDataReader.h"
 
+#include <algorithm>
+#include <filesystem>
+
 std::vector<Satellite> YAMLDataReader::getSatelliteCollection() const {
     std::vector<Satellite> satelliteVector{};
     SatelliteBuilder satelliteBuilder{};
@@ -15,7 +18,7 @@ std::vector<Satellite> YAMLDataReader::getSatelliteCollection() const {
     return satelliteVector;
 }
 
-Satellite YAMLDataReader::parseSatellite(SatelliteBuilder &satelliteBuilder, const YAML::Node &node) {
+Satellite YAMLDataReader::parseSatellite(SatelliteBuilder &satelliteBuilder, const YAML::Node &node) const {
     satelliteBuilder.reset();
     //Required for TLE
     size_t id = 0;
@@ -81,11 +84,16 @@ void YAMLDataReader::parseKepler(SatelliteBuilder &satelliteBuilder, const YAML:
     }
 }
 
-void YAMLDataReader::parseKepler(SatelliteBuilder &satelliteBuilder, size_t id, const std::string &tleFilepath) {
+void YAMLDataReader::parseKepler(SatelliteBuilder &satelliteBuilder, size_t id,
+                                 const std::string &tleFilepath) const {
     try {
-        TLEReader tleReader{tleFilepath};
-        auto mapping = tleReader.getMappingIDOrbitalElements();
-        satelliteBuilder.setOrbitalElements(mapping.at(id));
+        const auto &elements = getTLEIndex(tleFilepath);
+        const auto it = std::lower_bound(elements.begin(), elements.end(), id,
+                                         [](const auto &pair, size_t value) { return pair.first < value; });
+        if (it == elements.end() || it->first != id) {
+            throw std::out_of_range{"No TLE entry for the ID"};
+        }
+        satelliteBuilder.setOrbitalElements(it->second);
     } catch (std::exception &e) {
         std::stringstream message{};
         message << "The TLE file did not contain Kepler elements for the satellite with the ID " << id
@@ -93,3 +101,19 @@ void YAMLDataReader::parseKepler(SatelliteBuilder &satelliteBuilder, size_t id,
         throw std::runtime_error{message.str()};
     }
 }
+
+const std::vector<std::pair<size_t, OrbitalElements>> &
+YAMLDataReader::getTLEIndex(const std::string &tleFilepath) const {
+    std::error_code errorCode{};
+    auto key = std::filesystem::weakly_canonical(tleFilepath, errorCode).string();
+    if (errorCode) {
+        key = tleFilepath;
+    }
+    std::lock_guard<std::mutex> lock{_tleIndicesMutex};
+    auto it = _tleIndices.find(key);
+    if (it == _tleIndices.end()) {
+        TLEReader tleReader{tleFilepath};
+        it = _tleIndices.emplace(std::move(key), tleReader.getSortedIDOrbitalElements()).first;
+    }
+    return it->second;
+}
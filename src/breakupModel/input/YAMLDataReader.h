@@ -7,6 +7,9 @@
 #include <utility>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <map>
+#include <mutex>
 #include "yaml-cpp/yaml.h"
 #include "DataSource.h"
 #include "TLEReader.h"
@@ -46,6 +49,17 @@ class YAMLDataReader : public DataSource {
      */
     const YAML::Node _file;
 
+    /**
+     * The ID-sorted orbital elements of every TLE file referenced so far (key: the canonical path).
+     * Each TLE file is parsed only once per reader, regardless of how many satellites refer to it.
+     */
+    mutable std::map<std::string, std::vector<std::pair<size_t, OrbitalElements>>> _tleIndices;
+
+    /**
+     * Guards _tleIndices
+     */
+    mutable std::mutex _tleIndicesMutex;
+
 public:
 
     /**
@@ -64,6 +78,13 @@ public:
     explicit YAMLDataReader(std::string &&filename)
             : _file{YAML::LoadFile(filename)} {}
 
+    /**
+     * Creates a new YAML Data Reader from an already loaded node (e.g. the inline satellites of a service request).
+     * @param node - a node containing the satellites tag
+     */
+    explicit YAMLDataReader(YAML::Node node)
+            : _file{std::move(node)} {}
+
     /**
      * Returns a SatelliteCollection. Satellites are read from the YAML file.<br>
      *
@@ -86,7 +107,7 @@ private:
      * @return a new Satellite
      * @throws an runtime_error exception if the satellite is invalid
      */
-    static Satellite parseSatellite(SatelliteBuilder &satelliteBuilder, const YAML::Node &node);
+    Satellite parseSatellite(SatelliteBuilder &satelliteBuilder, const YAML::Node &node) const;
 
     /**
      * Parses the Keplerian Elements from a YAML Node.
@@ -104,7 +125,15 @@ private:
      * @param tleFilepath - the path to the TLE file
      * @throws a runtime_error if the TLE does not contain the satellite
      */
-    static void parseKepler(SatelliteBuilder &satelliteBuilder, size_t id, const std::string &tleFilepath);
+    void parseKepler(SatelliteBuilder &satelliteBuilder, size_t id, const std::string &tleFilepath) const;
+
+    /**
+     * Returns the ID-sorted orbital elements of a TLE file. The file is only parsed on the first call for a path.
+     * @param tleFilepath - the path to the TLE file
+     * @return reference to the cached index
+     * @throws an exception if the TLE file cannot be read
+     */
+    const std::vector<std::pair<size_t, OrbitalElements>> &getTLEIndex(const std::string &tleFilepath) const;
 
 };
 
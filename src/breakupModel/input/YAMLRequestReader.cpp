@@ -0,0 +1,115 @@
+#include "YAMLRequestReader.h"
+
+YAMLRequestReader::YAMLRequestReader(const std::string &request)
+        : _request{YAML::Load(request)} {
+    if (!_request.IsMap()) {
+        throw std::runtime_error{"The request is no YAML mapping!"};
+    }
+}
+
+std::optional<size_t> YAMLRequestReader::getRequestID() const {
+    if (_request[REQUEST_ID_TAG]) {
+        return std::make_optional(_request[REQUEST_ID_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+ResultFormat YAMLRequestReader::getResultFormat() const {
+    if (_request[FORMAT_TAG]) {
+        const auto format = _request[FORMAT_TAG].as<std::string>();
+        const auto it = stringToResultFormat.find(format);
+        if (it == stringToResultFormat.end()) {
+            throw std::runtime_error{"The format " + format + " of the request is unknown (csv or binary)!"};
+        }
+        return it->second;
+    } else {
+        return ResultFormat::CSV;
+    }
+}
+
+std::optional<std::uint64_t> YAMLRequestReader::getSeed() const {
+    if (_request[SEED_TAG]) {
+        return std::make_optional(_request[SEED_TAG].as<std::uint64_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+bool YAMLRequestReader::hasSatellites() const {
+    return _request[SATELLITES_TAG] && _request[SATELLITES_TAG].IsSequence();
+}
+
+double YAMLRequestReader::getMinimalCharacteristicLength() const {
+    if (_request[MIN_CHAR_LENGTH_TAG]) {
+        return _request[MIN_CHAR_LENGTH_TAG].as<double>();
+    } else {
+        throw std::runtime_error{"The minimal characteristic Length was not specified in the request!"};
+    }
+}
+
+SimulationType YAMLRequestReader::getTypeOfSimulation() const {
+    if (_request[SIMULATION_TYPE_TAG]) {
+        const auto simulationType = _request[SIMULATION_TYPE_TAG].as<std::string>();
+        const auto it = stringToSimulationType.find(simulationType);
+        if (it == stringToSimulationType.end()) {
+            throw std::runtime_error{"The simulation type " + simulationType + " of the request is unknown!"};
+        }
+        return it->second;
+    } else {
+        return SimulationType::UNKNOWN;
+    }
+}
+
+std::optional<size_t> YAMLRequestReader::getCurrentMaximalGivenID() const {
+    if (_request[CURRENT_MAX_ID_TAG]) {
+        return std::make_optional(_request[CURRENT_MAX_ID_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::shared_ptr<const DataSource> YAMLRequestReader::getDataReader() const {
+    if (!this->hasSatellites()) {
+        throw std::runtime_error{"The request contains no satellites!"};
+    }
+    //A request must not make the service read its files, so only inline Kepler elements are accepted
+    for (auto satNode : _request[SATELLITES_TAG]) {
+        if (satNode[KEPLER_TAG] && satNode[KEPLER_TAG].IsScalar()) {
+            throw std::runtime_error{"The satellites of a request cannot refer to a TLE file by kepler!"};
+        }
+    }
+    return std::make_shared<YAMLDataReader>(_request);
+}
+
+std::optional<std::set<size_t>> YAMLRequestReader::getIDFilter() const {
+    if (_request[ID_FILTER_TAG] && _request[ID_FILTER_TAG].IsSequence()) {
+        std::set<size_t> filterSet{};
+        for (auto id : _request[ID_FILTER_TAG]) {
+            filterSet.insert(id.as<size_t>());
+        }
+        return std::make_optional(filterSet);
+    }
+    return std::nullopt;
+}
+
+bool YAMLRequestReader::getEnforceMassConservation() const {
+    if (_request[ENFORCE_MASS_CONSERVATION_TAG]) {
+        return _request[ENFORCE_MASS_CONSERVATION_TAG].as<bool>();
+    } else {
+        return false;
+    }
+}
+
+ExecutionMode YAMLRequestReader::getExecutionMode() const {
+    if (_request[EXECUTION_MODE_TAG]) {
+        const auto mode = _request[EXECUTION_MODE_TAG].as<std::string>();
+        const auto it = InputConfigurationSource::stringToExecutionMode.find(mode);
+        if (it == InputConfigurationSource::stringToExecutionMode.end()) {
+            throw std::runtime_error{"The execution mode " + mode + " is unknown! Use STAGED or FUSED."};
+        }
+        return it->second;
+    } else {
+        return ExecutionMode::STAGED;
+    }
+}
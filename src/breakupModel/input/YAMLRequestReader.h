@@ -0,0 +1,128 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <map>
+#include <set>
+#include <optional>
+#include <cstdint>
+#include "yaml-cpp/yaml.h"
+#include "InputConfigurationSource.h"
+#include "DataSource.h"
+#include "YAMLDataReader.h"
+
+/**
+ * The encoding of the fragments in the response to a request.
+ */
+enum class ResultFormat {
+    /**
+     * The CSV lines of the CSVWriter (including the header line)
+     */
+    CSV,
+
+    /**
+     * The columnar binary format of the BinaryWriter
+     */
+    BINARY
+};
+
+/**
+ * Reads one request of the BreakupService: a YAML mapping in one line (e.g. a flow mapping or JSON) like
+ * <br>{id: 7, idFilter: [24946], minimalCharacteristicLength: 0.1, simulationType: EXPLOSION, seed: 42}<br>
+ * The keys are named after the setters of the BreakupBuilder. Instead of selecting satellites of the catalog by the
+ * idFilter, the request can also contain the satellites itself in the format of the YAMLDataReader.
+ */
+class YAMLRequestReader : public InputConfigurationSource {
+
+    /*
+    * The following static variables contain the names of the YAML nodes.
+    * Note: C++20 would allow constexpr std::string which would be more appropriate instead of char[]
+    */
+    static constexpr char REQUEST_ID_TAG[] = "id";
+    static constexpr char FORMAT_TAG[] = "format";
+    static constexpr char SEED_TAG[] = "seed";
+    static constexpr char MIN_CHAR_LENGTH_TAG[] = "minimalCharacteristicLength";
+    static constexpr char SIMULATION_TYPE_TAG[] = "simulationType";
+    static constexpr char CURRENT_MAX_ID_TAG[] = "currentMaxID";
+    static constexpr char ID_FILTER_TAG[] = "idFilter";
+    static constexpr char ENFORCE_MASS_CONSERVATION_TAG[] = "enforceMassConservation";
+    static constexpr char EXECUTION_MODE_TAG[] = "executionMode";
+    static constexpr char SATELLITES_TAG[] = "satellites";
+    static constexpr char KEPLER_TAG[] = "kepler";
+
+    /**
+     * The root node of the request
+     */
+    const YAML::Node _request;
+
+public:
+
+    inline const static std::map<std::string, ResultFormat> stringToResultFormat{
+            {"csv",    ResultFormat::CSV},
+            {"CSV",    ResultFormat::CSV},
+            {"binary", ResultFormat::BINARY},
+            {"BINARY", ResultFormat::BINARY}
+    };
+
+    /**
+     * Creates a new YAML Request Reader.
+     * @param request - the request as YAML text
+     * @throws an exception if the request is malformed or no mapping
+     */
+    explicit YAMLRequestReader(const std::string &request);
+
+    /**
+     * Returns the ID of the request which is repeated in the response, if given.
+     * @return std::optional<size_t>
+     */
+    std::optional<size_t> getRequestID() const;
+
+    /**
+     * Returns the format of the response (Default: CSV).
+     * @return ResultFormat
+     * @throws a runtime_error if the format is unknown
+     */
+    ResultFormat getResultFormat() const;
+
+    /**
+     * Returns the seed of the random numbers if given.
+     * @return seed or empty
+     */
+    std::optional<std::uint64_t> getSeed() const;
+
+    /**
+     * Returns true if the request contains its own satellites instead of referring to the catalog.
+     * @return true or false
+     */
+    bool hasSatellites() const;
+
+    double getMinimalCharacteristicLength() const override;
+
+    /**
+     * Returns the type of the simulation, UNKNOWN if it is not given.
+     * @return SimulationType
+     * @throws a runtime_error if the type is given but cannot be parsed
+     */
+    SimulationType getTypeOfSimulation() const override;
+
+    std::optional<size_t> getCurrentMaximalGivenID() const override;
+
+    /**
+     * Returns a YAMLDataReader over the satellites of the request.
+     * @return DataSource as shared pointer
+     * @throws a runtime_error if the request contains no satellites or one of them refers to a TLE file
+     */
+    std::shared_ptr<const DataSource> getDataReader() const override;
+
+    std::optional<std::set<size_t>> getIDFilter() const override;
+
+    bool getEnforceMassConservation() const override;
+
+    /**
+     * Returns how the simulation sweeps over the fragments (STAGED or FUSED).
+     * @return the given ExecutionMode, otherwise STAGED
+     * @throws a runtime_error if the mode is given but unknown
+     */
+    ExecutionMode getExecutionMode() const override;
+
+};
@@ -0,0 +1,68 @@
+#include "YAMLScenarioReader.h"
+
+#include "breakupModel/util/UtilityRandom.h"
+
+YAMLScenarioReader::YAMLScenarioReader(const std::string &filename)
+        : _file{YAML::LoadFile(filename)} {
+    if (!_file[SCENARIO_TAG]) {
+        throw std::runtime_error{"No tag found the YAML file which specifies the scenario!"};
+    }
+    if (!_file[SCENARIO_TAG][EVENTS_TAG] || !_file[SCENARIO_TAG][EVENTS_TAG].IsSequence()
+        || _file[SCENARIO_TAG][EVENTS_TAG].size() == 0) {
+        throw std::runtime_error{"The scenario in the YAML file contains no events!"};
+    }
+}
+
+bool YAMLScenarioReader::isScenario(const std::string &filename) {
+    return static_cast<bool>(YAML::LoadFile(filename)[SCENARIO_TAG]);
+}
+
+std::shared_ptr<const DataSource> YAMLScenarioReader::getDataReader() const {
+    std::vector<std::string> fileNames{};
+    if (_file[SCENARIO_TAG][INPUT_SOURCE_TAG] && _file[SCENARIO_TAG][INPUT_SOURCE_TAG].IsSequence()) {
+        for (auto inputSource : _file[SCENARIO_TAG][INPUT_SOURCE_TAG]) {
+            fileNames.push_back(inputSource.as<std::string>());
+        }
+    }
+    return YAMLConfigurationReader::createDataReader(fileNames);
+}
+
+std::optional<size_t> YAMLScenarioReader::getCurrentMaximalGivenID() const {
+    if (_file[SCENARIO_TAG][CURRENT_MAX_ID_TAG]) {
+        return std::make_optional(_file[SCENARIO_TAG][CURRENT_MAX_ID_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::uint64_t> YAMLScenarioReader::getSeed() const {
+    if (_file[SCENARIO_TAG][SEED_TAG]) {
+        return std::make_optional(_file[SCENARIO_TAG][SEED_TAG].as<std::uint64_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::vector<std::shared_ptr<YAMLConfigurationReader>> YAMLScenarioReader::getEvents() const {
+    const auto seed = this->getSeed();
+    std::vector<std::shared_ptr<YAMLConfigurationReader>> events{};
+    size_t eventNumber = 0;
+    for (const auto &eventNode : _file[SCENARIO_TAG][EVENTS_TAG]) {
+        YAML::Node event = YAML::Clone(eventNode);
+        if (!event[SIMULATION_TAG]) {
+            throw std::runtime_error{"The event " + std::to_string(eventNumber) +
+                                     " of the scenario does not specify the simulation!"};
+        }
+        if (event[SIMULATION_TAG][INPUT_SOURCE_TAG]) {
+            throw std::runtime_error{"The event " + std::to_string(eventNumber) +
+                                     " of the scenario defines its own inputSource, but all events share the "
+                                     "inputSource of the scenario!"};
+        }
+        if (!event[SIMULATION_TAG][SEED_TAG] && seed.has_value()) {
+            event[SIMULATION_TAG][SEED_TAG] = util::deriveSeed(seed.value(), eventNumber);
+        }
+        events.push_back(std::make_shared<YAMLConfigurationReader>(event));
+        ++eventNumber;
+    }
+    return events;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <cstdint>
+#include "yaml-cpp/yaml.h"
+#include "DataSource.h"
+#include "YAMLConfigurationReader.h"
+
+/**
+ * Reads a scenario from an YAML file: a list of breakup events which share one input source.
+ * Every event is an ordinary configuration (simulation, inputOutput, resultOutput) without an inputSource, it is
+ * returned as its own YAMLConfigurationReader.
+ */
+class YAMLScenarioReader {
+
+    /*
+    * The following static variables contain the names of the YAML nodes.
+    * Note: C++20 would allow constexpr std::string which would be more appropriate instead of char[]
+    */
+    static constexpr char SCENARIO_TAG[] = "scenario";
+    static constexpr char INPUT_SOURCE_TAG[] = "inputSource";
+    static constexpr char CURRENT_MAX_ID_TAG[] = "currentMaxID";
+    static constexpr char SEED_TAG[] = "seed";
+    static constexpr char EVENTS_TAG[] = "events";
+    static constexpr char SIMULATION_TAG[] = "simulation";
+
+    /**
+     * The root node of the YAML file
+     */
+    const YAML::Node _file;
+
+public:
+
+    /**
+     * Creates a new YAML Scenario Reader.
+     * @param filename
+     * @throws an exception if the file is malformed or cannot be loaded or if it contains no scenario with events
+     */
+    explicit YAMLScenarioReader(const std::string &filename);
+
+    /**
+     * Checks if the given YAML file contains a scenario (instead of a single simulation).
+     * @param filename
+     * @return true if the file has a scenario tag
+     * @throws an exception if the file is malformed or cannot be loaded
+     */
+    static bool isScenario(const std::string &filename);
+
+    /**
+     * Returns the DataSource shared by all events.
+     * @return DataSource as shared pointer
+     * @throws a runtime_error if the inputSource is missing or invalid
+     */
+    std::shared_ptr<const DataSource> getDataReader() const;
+
+    /**
+     * Returns the maximal given (NORAD-Catalog) ID before the first event if given.
+     * @return std::optional<size_t>
+     */
+    std::optional<size_t> getCurrentMaximalGivenID() const;
+
+    /**
+     * Returns the seed of the scenario if given.
+     * @return seed or empty
+     */
+    std::optional<std::uint64_t> getSeed() const;
+
+    /**
+     * Returns the configurations of the events in the order of the file.
+     * An event without own seed gets a seed derived from the seed of the scenario (if given).
+     * @return vector of configurations
+     * @throws a runtime_error if an event is malformed or defines its own inputSource
+     */
+    std::vector<std::shared_ptr<YAMLConfigurationReader>> getEvents() const;
+
+};
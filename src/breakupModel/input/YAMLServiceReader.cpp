@@ -0,0 +1,46 @@
+#include "YAMLServiceReader.h"
+
+YAMLServiceReader::YAMLServiceReader(const std::string &filename)
+        : _file{YAML::LoadFile(filename)} {
+    if (!_file[SERVICE_TAG]) {
+        throw std::runtime_error{"No tag found the YAML file which specifies the service!"};
+    }
+}
+
+bool YAMLServiceReader::isService(const std::string &filename) {
+    return static_cast<bool>(YAML::LoadFile(filename)[SERVICE_TAG]);
+}
+
+std::shared_ptr<const DataSource> YAMLServiceReader::getDataReader() const {
+    std::vector<std::string> fileNames{};
+    if (_file[SERVICE_TAG][INPUT_SOURCE_TAG] && _file[SERVICE_TAG][INPUT_SOURCE_TAG].IsSequence()) {
+        for (auto inputSource : _file[SERVICE_TAG][INPUT_SOURCE_TAG]) {
+            fileNames.push_back(inputSource.as<std::string>());
+        }
+    }
+    return YAMLConfigurationReader::createDataReader(fileNames);
+}
+
+std::optional<size_t> YAMLServiceReader::getCurrentMaximalGivenID() const {
+    if (_file[SERVICE_TAG][CURRENT_MAX_ID_TAG]) {
+        return std::make_optional(_file[SERVICE_TAG][CURRENT_MAX_ID_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::string> YAMLServiceReader::getSocketPath() const {
+    if (_file[SERVICE_TAG][SOCKET_TAG]) {
+        return std::make_optional(_file[SERVICE_TAG][SOCKET_TAG].as<std::string>());
+    } else {
+        return std::nullopt;
+    }
+}
+
+std::optional<size_t> YAMLServiceReader::getWorkerCount() const {
+    if (_file[SERVICE_TAG][WORKERS_TAG]) {
+        return std::make_optional(_file[SERVICE_TAG][WORKERS_TAG].as<size_t>());
+    } else {
+        return std::nullopt;
+    }
+}
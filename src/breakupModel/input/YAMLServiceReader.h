@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <optional>
+#include "yaml-cpp/yaml.h"
+#include "DataSource.h"
+#include "YAMLConfigurationReader.h"
+
+/**
+ * Reads the configuration of the BreakupService from an YAML file: the inputSource of the catalog which is kept in
+ * memory, optionally the maximal given ID, the path of the Unix domain socket and the number of workers.
+ */
+class YAMLServiceReader {
+
+    /*
+    * The following static variables contain the names of the YAML nodes.
+    * Note: C++20 would allow constexpr std::string which would be more appropriate instead of char[]
+    */
+    static constexpr char SERVICE_TAG[] = "service";
+    static constexpr char INPUT_SOURCE_TAG[] = "inputSource";
+    static constexpr char CURRENT_MAX_ID_TAG[] = "currentMaxID";
+    static constexpr char SOCKET_TAG[] = "socket";
+    static constexpr char WORKERS_TAG[] = "workers";
+
+    /**
+     * The root node of the YAML file
+     */
+    const YAML::Node _file;
+
+public:
+
+    /**
+     * Creates a new YAML Service Reader.
+     * @param filename
+     * @throws an exception if the file is malformed or cannot be loaded or if it contains no service tag
+     */
+    explicit YAMLServiceReader(const std::string &filename);
+
+    /**
+     * Checks if the given YAML file configures the service (instead of a single simulation).
+     * @param filename
+     * @return true if the file has a service tag
+     * @throws an exception if the file is malformed or cannot be loaded
+     */
+    static bool isService(const std::string &filename);
+
+    /**
+     * Returns the DataSource of the catalog.
+     * @return DataSource as shared pointer
+     * @throws a runtime_error if the inputSource is missing or invalid
+     */
+    std::shared_ptr<const DataSource> getDataReader() const;
+
+    /**
+     * Returns the maximal given (NORAD-Catalog) ID used by requests without their own, if given.
+     * @return std::optional<size_t>
+     */
+    std::optional<size_t> getCurrentMaximalGivenID() const;
+
+    /**
+     * Returns the path of the Unix domain socket, if not given the requests are read from stdin.
+     * @return std::optional<std::string>
+     */
+    std::optional<std::string> getSocketPath() const;
+
+    /**
+     * Returns the number of requests handled concurrently per connection, if given.
+     * @return std::optional<size_t>
+     */
+    std::optional<size_t> getWorkerCount() const;
+
+};
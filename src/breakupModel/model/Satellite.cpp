@@ -121,13 +121,22 @@ void Satellite::setCartesianByOrbitalElements(const OrbitalElements &orbitalElem
 }
 
 OrbitalElements Satellite::getOrbitalElements() const {
-    using namespace util;
-
     //Save same expensive operations by using the cache
     if (_orbitalElementsCache.has_value()) {
         return _orbitalElementsCache.value();
     }
 
+    OrbitalElements orbitalElements = calculateOrbitalElements(_position, _velocity);
+
+    //Sets the orbital elements cache to the new calculated values
+    _orbitalElementsCache = std::make_optional(orbitalElements);
+    return orbitalElements;
+}
+
+OrbitalElements Satellite::calculateOrbitalElements(const std::array<double, 3> &position,
+                                                    const std::array<double, 3> &velocity) {
+    using namespace util;
+
     std::array<double, 6> keplerianElements{};
 
     std::array<double, 3> k = {0.0, 0.0, 1.0};
@@ -140,7 +149,7 @@ OrbitalElements Satellite::getOrbitalElements() const {
     double p, temp, R0, ni;
 
     // 1 - We compute h: the orbital angular momentum vector
-    h = cross(_position, _velocity);
+    h = cross(position, velocity);
 
     // 2 - We compute p: the orbital parameter
     p = dot(h, h) / GRAVITATIONAL_PARAMETER_EARTH; // h^2 / mu
@@ -153,9 +162,9 @@ OrbitalElements Satellite::getOrbitalElements() const {
     n = n / euclideanNorm(n);
 
     // 4 - We compute evett: the eccentricity vector
-    R0 = euclideanNorm(_position);
-    Dum_Vec = cross(_velocity, h);
-    evett = Dum_Vec / GRAVITATIONAL_PARAMETER_EARTH - _position / R0;
+    R0 = euclideanNorm(position);
+    Dum_Vec = cross(velocity, h);
+    evett = Dum_Vec / GRAVITATIONAL_PARAMETER_EARTH - position / R0;
 
     // The eccentricity is calculated and stored as the second orbital element
     keplerianElements[1] = euclideanNorm(evett);
@@ -179,12 +188,12 @@ OrbitalElements Satellite::getOrbitalElements() const {
         keplerianElements[3] = PI2 - keplerianElements[3];
     }
 
-    temp = dot(evett, _position);
+    temp = dot(evett, position);
 
     // 4 - We compute ni: the true anomaly (in 0, 2*PI)
     ni = std::acos(temp / keplerianElements[1] / R0);
 
-    temp = dot(_position, _velocity);
+    temp = dot(position, velocity);
 
     if (temp < 0.0) {
         ni = PI2 - ni;
@@ -207,11 +216,7 @@ OrbitalElements Satellite::getOrbitalElements() const {
         keplerianElements[5] += PI2;
     }
 
-    OrbitalElements orbitalElements {keplerianElements};
-
-    //Sets the orbital elements cache to the new calculated values
-    _orbitalElementsCache = std::make_optional(orbitalElements);
-    return orbitalElements;
+    return OrbitalElements{keplerianElements};
 }
 
 std::ostream &operator<<(std::ostream &os, const Satellite &satellite) {
@@ -185,6 +185,20 @@ public:
      */
     void setCartesianByOrbitalElements(const OrbitalElements &orbitalElements);
 
+    /**
+     * Sets the cartesian velocity and position together with the Keplerian Elements describing the same state.
+     * No conversion takes place, e.g. if both representations were stored together.
+     * @param position - cartesian vector
+     * @param velocity - cartesian vector
+     * @param orbitalElements - the Keplerian Elements, stored in the _orbitalElementsCache
+     */
+    void setCartesianWithOrbitalElements(const std::array<double, 3> &position, const std::array<double, 3> &velocity,
+                                         const OrbitalElements &orbitalElements) {
+        _position = position;
+        _velocity = velocity;
+        _orbitalElementsCache = std::make_optional(orbitalElements);
+    }
+
     /**
      * Calculates the Keplerian Elements by using the satellite's caretsian position and velocity vectors.
      * @return the Orbital Elements
@@ -195,6 +209,16 @@ public:
      */
     OrbitalElements getOrbitalElements() const;
 
+    /**
+     * Calculates the Keplerian Elements from a cartesian position and velocity vector.
+     * This is used by getOrbitalElements() and by the output of an SoA which has no Satellite objects.
+     * @param position - the cartesian position vector in [m]
+     * @param velocity - the cartesian velocity vector in [m/s]
+     * @return the Orbital Elements
+     */
+    static OrbitalElements calculateOrbitalElements(const std::array<double, 3> &position,
+                                                    const std::array<double, 3> &velocity);
+
     /**
      * Compares two Satellites by comparing their IDs.
      * @param lhs - Satellite
@@ -0,0 +1,32 @@
+#include "SatelliteCatalog.h"
+
+#include <algorithm>
+
+SatelliteCatalog::SatelliteCatalog(std::vector<Satellite> satellites)
+        : _satellites{std::move(satellites)} {
+    _idIndex.reserve(_satellites.size());
+    for (size_t i = 0; i < _satellites.size(); ++i) {
+        const size_t id = _satellites[i].getId();
+        _idIndex.emplace(id, i);
+        _maximalID = std::max(_maximalID, id);
+    }
+}
+
+std::vector<Satellite> SatelliteCatalog::select(const std::set<size_t> &ids) const {
+    std::vector<size_t> indices{};
+    for (size_t id : ids) {
+        const auto [begin, end] = _idIndex.equal_range(id);
+        for (auto it = begin; it != end; ++it) {
+            indices.push_back(it->second);
+        }
+    }
+    //Keep the order of the catalog (e.g. the first satellite of a collision)
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<Satellite> selection{};
+    selection.reserve(indices.size());
+    for (size_t index : indices) {
+        selection.push_back(_satellites[index]);
+    }
+    return selection;
+}
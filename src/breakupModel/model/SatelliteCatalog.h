@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include <cstddef>
+
+#include "Satellite.h"
+
+/**
+ * An immutable collection of input satellites (e.g. a whole catalog) with an index from the satellite ID to its
+ * position in the collection. Selecting a few satellites by their ID therefore only costs O(k) lookups and only the
+ * selected satellites are copied.
+ * @note The catalog is meant to be shared (std::shared_ptr<const SatelliteCatalog>), e.g. by several BreakupBuilder.
+ */
+class SatelliteCatalog {
+
+    /**
+     * The satellites in the order of the input
+     */
+    std::vector<Satellite> _satellites;
+
+    /**
+     * Maps the ID to the index in _satellites (an ID can appear multiple times)
+     */
+    std::unordered_multimap<size_t, size_t> _idIndex;
+
+    /**
+     * The maximal ID of the satellites (zero if empty)
+     */
+    size_t _maximalID{0};
+
+public:
+
+    SatelliteCatalog() = default;
+
+    /**
+     * Creates a new catalog and builds the ID index.
+     * @param satellites - the input satellites
+     */
+    explicit SatelliteCatalog(std::vector<Satellite> satellites);
+
+    /**
+     * Returns the satellites whose ID is contained in the given set, in the order of the catalog.
+     * @param ids - the IDs to select
+     * @return copies of the selected satellites
+     */
+    [[nodiscard]] std::vector<Satellite> select(const std::set<size_t> &ids) const;
+
+    /**
+     * Returns the satellites of the catalog.
+     * @return vector of satellites
+     */
+    [[nodiscard]] const std::vector<Satellite> &getSatellites() const {
+        return _satellites;
+    }
+
+    /**
+     * Returns the maximal ID of the satellites in the catalog.
+     * @return maximal ID or zero if the catalog is empty
+     */
+    [[nodiscard]] size_t getMaximalID() const {
+        return _maximalID;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _satellites.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _satellites.empty();
+    }
+
+};
@@ -1,40 +1,31 @@
 #include "Satellites.h"
 
-std::vector<std::tuple<double &, std::array<double, 3> &, std::array<double, 3> &>> Satellites::getVelocityTuple() {
-    std::vector<std::tuple<double &, std::array<double, 3> &, std::array<double, 3> &>> vector{};
-    vector.reserve(size());
-    for (size_t i = 0; i < size(); ++i) {
-        vector.emplace_back(areaToMassRatio[i], velocity[i], ejectionVelocity[i]);
-    }
-    return vector;
+#include <map>
+#include <stdexcept>
+
+util::ZipRange<util::IndexColumn, double *> Satellites::getCharacteristicLengthTuple() {
+    return util::ZipRange{size(), util::IndexColumn{}, characteristicLength.data()};
 }
 
-std::vector<std::tuple<double &, double &, double &, double &>> Satellites::getAreaMassTuple() {
-    std::vector<std::tuple<double &, double &, double &, double &>> vector{};
-    vector.reserve(size());
-    for (size_t i = 0; i < size(); ++i) {
-        vector.emplace_back(characteristicLength[i], areaToMassRatio[i], area[i], mass[i]);
-    }
-    return vector;
+util::ZipRange<util::IndexColumn, double *, std::array<double, 3> *, std::array<double, 3> *>
+Satellites::getVelocityTuple() {
+    return util::ZipRange{size(), util::IndexColumn{}, areaToMassRatio.data(), velocity.data(),
+                          ejectionVelocity.data()};
 }
 
-std::vector<std::tuple<double &, double &, std::array<double, 3> &, std::shared_ptr<const std::string> &>>
-Satellites::getCMVNTuple() {
-    std::vector<std::tuple<double &, double &, std::array<double, 3> &, std::shared_ptr<const std::string> &>> vector{};
-    vector.reserve(size());
-    for (size_t i = 0; i < size(); ++i) {
-        vector.emplace_back(characteristicLength[i], mass[i], velocity[i], name[i]);
-    }
-    return vector;
+util::ZipRange<util::IndexColumn, double *, double *, double *, double *> Satellites::getAreaMassTuple() {
+    return util::ZipRange{size(), util::IndexColumn{}, characteristicLength.data(), areaToMassRatio.data(),
+                          area.data(), mass.data()};
 }
 
-std::vector<std::tuple<std::array<double, 3> &, std::shared_ptr<const std::string> &>> Satellites::getVNTuple() {
-    std::vector<std::tuple<std::array<double, 3> &, std::shared_ptr<const std::string> &>> vector{};
-    vector.reserve(size());
-    for (size_t i = 0; i < size(); ++i) {
-        vector.emplace_back(velocity[i], name[i]);
-    }
-    return vector;
+util::ZipRange<util::IndexColumn, double *, double *, std::array<double, 3> *, std::uint8_t *>
+Satellites::getCMVPTuple() {
+    return util::ZipRange{size(), util::IndexColumn{}, characteristicLength.data(), mass.data(), velocity.data(),
+                          parent.data()};
+}
+
+util::ZipRange<util::IndexColumn, std::array<double, 3> *, std::uint8_t *> Satellites::getVPTuple() {
+    return util::ZipRange{size(), util::IndexColumn{}, velocity.data(), parent.data()};
 }
 
 std::vector<Satellite> Satellites::getAoS() const {
@@ -43,7 +34,7 @@ std::vector<Satellite> Satellites::getAoS() const {
     size_t id = startId;
     vector.reserve(size);
 
-    auto nameIt = name.begin();
+    auto parentIt = parent.begin();
     auto lcIt = characteristicLength.begin();
     auto amIt = areaToMassRatio.begin();
     auto mIt = mass.begin();
@@ -51,12 +42,20 @@ std::vector<Satellite> Satellites::getAoS() const {
     auto vIt = velocity.begin();
     auto evIt = ejectionVelocity.begin();
 
-    for (; lcIt != characteristicLength.end(); ++nameIt, ++lcIt, ++amIt, ++mIt, ++aIt, ++vIt, ++evIt) {
-        vector.emplace_back(id++, *nameIt, satType, *lcIt, *amIt, *mIt, *aIt, *vIt, *evIt, position);
+    for (; lcIt != characteristicLength.end(); ++parentIt, ++lcIt, ++amIt, ++mIt, ++aIt, ++vIt, ++evIt) {
+        vector.emplace_back(id++, nameTable.at(*parentIt), satType, *lcIt, *amIt, *mIt, *aIt, *vIt, *evIt, position);
     }
     return vector;
 }
 
+std::uint8_t Satellites::appendName(std::shared_ptr<const std::string> name) {
+    if (nameTable.size() >= MAX_NAME_COUNT) {
+        throw std::length_error{"The Satellites support at most 256 different names!"};
+    }
+    nameTable.push_back(std::move(name));
+    return static_cast<std::uint8_t>(nameTable.size() - 1);
+}
+
 void Satellites::popBack() {
     this->resize(this->size() - 1);
 }
@@ -67,3 +66,36 @@ std::tuple<double &, double &, double &, double &> Satellites::appendElement() {
             {characteristicLength.back(), areaToMassRatio.back(), area.back(), mass.back()};
 }
 
+Satellites Satellites::fromAoS(const std::vector<Satellite> &satelliteCollection) {
+    Satellites satellites{};
+    if (satelliteCollection.empty()) {
+        return satellites;
+    }
+    const Satellite &first = satelliteCollection.front();
+    satellites.startId = first.getId();
+    satellites.satType = first.getSatType();
+    satellites.position = first.getPosition();
+    satellites.resize(satelliteCollection.size());
+
+    std::map<std::string, std::uint8_t> nameIndex{};
+    for (size_t i = 0; i < satelliteCollection.size(); ++i) {
+        const Satellite &sat = satelliteCollection[i];
+        if (sat.getId() != satellites.startId + i || sat.getSatType() != satellites.satType
+            || sat.getPosition() != satellites.position) {
+            throw std::invalid_argument{"The Satellites require consecutive IDs and a shared type and position!"};
+        }
+        auto it = nameIndex.find(sat.getName());
+        if (it == nameIndex.end()) {
+            const std::uint8_t index = satellites.appendName(std::make_shared<const std::string>(sat.getName()));
+            it = nameIndex.emplace(sat.getName(), index).first;
+        }
+        satellites.parent[i] = it->second;
+        satellites.characteristicLength[i] = sat.getCharacteristicLength();
+        satellites.areaToMassRatio[i] = sat.getAreaToMassRatio();
+        satellites.mass[i] = sat.getMass();
+        satellites.area[i] = sat.getArea();
+        satellites.ejectionVelocity[i] = sat.getEjectionVelocity();
+        satellites.velocity[i] = sat.getVelocity();
+    }
+    return satellites;
+}
@@ -6,8 +6,11 @@
 #include <tuple>
 #include <algorithm>
 #include <memory>
+#include <cstdint>
+#include <string>
 
 #include "Satellite.h"
+#include "breakupModel/util/UtilityZip.h"
 
 /**
  * This class implements the Satellites in an SoA (Structure of Array) way.
@@ -40,14 +43,25 @@ public:
      */
     std::array<double, 3> position{};
 
+    /**
+     * The maximal number of names in the nameTable (the parent index is an uint8_t)
+     */
+    static constexpr size_t MAX_NAME_COUNT = 256;
+
+    /**
+     * The names of the Satellites in the SoA, each Satellite refers to one entry of this table via its parent index
+     * (e.g. one name per parent of a breakup), use appendName() to add names
+     */
+    std::vector<std::shared_ptr<const std::string>> nameTable;
+
     /*
      * Unique Properties
      */
 
     /**
-     * The name of each of the Satellites in the SoA
+     * The index of the name (in nameTable) of each of the Satellites in the SoA
      */
-    std::vector<std::shared_ptr<const std::string>> name;
+    std::vector<std::uint8_t> parent;
 
     /**
      * The characteristic length of each satellite in [m]
@@ -90,39 +104,75 @@ public:
         this->resize(size);
     }
 
+    /**
+     * Creates a Structure of Arrays from an Array of Structures.
+     * This requires consecutive IDs, a shared type and position and at most 256 different names.
+     * @param satelliteCollection - vector of Satellites
+     * @return Satellites
+     * @throws std::invalid_argument if the AoS cannot be represented by one SoA
+     * @throws std::length_error if the AoS contains more than MAX_NAME_COUNT different names
+     */
+    static Satellites fromAoS(const std::vector<Satellite> &satelliteCollection);
+
     /**
      * Returns this Structure of Arrays as an Array of Structures.
      * @return vector of Satellites
+     * @throws std::out_of_range if a parent index does not refer to an entry of the nameTable
      */
     std::vector<Satellite> getAoS() const;
 
     /**
-     * Returns a tuple view of this Satellites collection containing in the order of appearance:
-     * characteristic Length, velocity, ejection velocity
-     * @return vector of tuple of characteristic Length, velocity, ejection velocity
+     * Returns a lazy tuple view of this Satellites collection containing in the order of appearance:
+     * index, characteristic Length
+     * @return range of tuple of index, characteristic Length
      */
-    std::vector<std::tuple<double &, std::array<double, 3> &, std::array<double, 3>&>> getVelocityTuple();
+    util::ZipRange<util::IndexColumn, double *> getCharacteristicLengthTuple();
 
     /**
-    * Returns a tuple view of this Satellites collection containing in the order of appearance:
-    * characteristic Length, area-to-mass-ratio, area, mass
-    * @return vector of tuple of characteristic Length, area-to-mass-ratio, area, mass
+     * Returns a lazy tuple view of this Satellites collection containing in the order of appearance:
+     * index, area-to-mass-ratio, velocity, ejection velocity
+     * @return range of tuple of index, area-to-mass-ratio, velocity, ejection velocity
+     */
+    util::ZipRange<util::IndexColumn, double *, std::array<double, 3> *, std::array<double, 3> *> getVelocityTuple();
+
+    /**
+    * Returns a lazy tuple view of this Satellites collection containing in the order of appearance:
+    * index, characteristic Length, area-to-mass-ratio, area, mass
+    * @return range of tuple of index, characteristic Length, area-to-mass-ratio, area, mass
     */
-    std::vector<std::tuple<double &, double &, double &, double &>> getAreaMassTuple();
+    util::ZipRange<util::IndexColumn, double *, double *, double *, double *> getAreaMassTuple();
 
     /**
-    * Returns a tuple view of this Satellites collection containing in the order of appearance:
-    * characteristic Length, mass, velocity and name pointer
-    * @return vector of tuple of characteristic Length, mass, velocity and name pointer
+    * Returns a lazy tuple view of this Satellites collection containing in the order of appearance:
+    * index, characteristic Length, mass, velocity and parent index
+    * @return range of tuple of index, characteristic Length, mass, velocity and parent index
     */
-    std::vector<std::tuple<double &, double &, std::array<double, 3> &, std::shared_ptr<const std::string> &>> getCMVNTuple();
+    util::ZipRange<util::IndexColumn, double *, double *, std::array<double, 3> *, std::uint8_t *> getCMVPTuple();
 
     /**
-    * Returns a tuple view of this Satellites collection containing in the order of appearance:
-    * velocity and name pointer
-    * @return vector of tuple of velocity and name pointer
+    * Returns a lazy tuple view of this Satellites collection containing in the order of appearance:
+    * index, velocity and parent index
+    * @return range of tuple of index, velocity and parent index
     */
-    std::vector<std::tuple<std::array<double, 3> &, std::shared_ptr<const std::string> &>> getVNTuple();
+    util::ZipRange<util::IndexColumn, std::array<double, 3> *, std::uint8_t *> getVPTuple();
+
+    /**
+     * Appends a name to the nameTable.
+     * @param name - the name
+     * @return the parent index referring to the name
+     * @throws std::length_error if the nameTable already contains MAX_NAME_COUNT names
+     */
+    std::uint8_t appendName(std::shared_ptr<const std::string> name);
+
+    /**
+     * Returns the name of one Satellite by resolving its parent index.
+     * @param index - the position of the Satellite in the SoA
+     * @return name
+     * @throws std::out_of_range if the parent index does not refer to an entry of the nameTable
+     */
+    const std::string &getName(size_t index) const {
+        return *nameTable.at(parent[index]);
+    }
 
     /**
      * Returns the size of this element.
@@ -137,7 +187,7 @@ public:
      * @param newSize
      */
     void resize(size_t newSize) {
-        name.resize(newSize);
+        parent.resize(newSize);
         characteristicLength.resize(newSize);
         areaToMassRatio.resize(newSize);
         mass.resize(newSize);
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <cstdint>
+#include <string>
+
+#include "Satellite.h"
+#include "Satellites.h"
+
+/**
+ * Non-owning, read-only view of a Satellites SoA whose columns are stored elsewhere (e.g. in a memory mapped file).
+ * The members are named like those of Satellites, the unique properties are pointers to the first element of each
+ * column instead of vectors. The view is only valid as long as the memory it refers to.
+ */
+class SatellitesView {
+
+public:
+
+    /*
+     * Shared Properties
+     */
+
+    /**
+     * The NORAD Catalog ID of the first Satellite
+     */
+    size_t startId{};
+
+    /**
+     * The SatType of the Satellites
+     */
+    SatType satType{SatType::DEBRIS};
+
+    /**
+     * The position base of the Satellites in [m]
+     */
+    std::array<double, 3> position{};
+
+    /**
+     * The names of the Satellites, each Satellite refers to one entry via its parent index
+     */
+    std::vector<std::shared_ptr<const std::string>> nameTable;
+
+    /*
+     * Unique Properties
+     */
+
+    /**
+     * The index of the name (in nameTable) of each Satellite
+     */
+    const std::uint8_t *parent{};
+
+    /**
+     * The characteristic length of each satellite in [m]
+     */
+    const double *characteristicLength{};
+
+    /**
+     * The area-to-mass ratio of each satellite in [m^2/kg]
+     */
+    const double *areaToMassRatio{};
+
+    /**
+     * The mass of each satellite in [kg]
+     */
+    const double *mass{};
+
+    /**
+     * The area/ Radar-Cross-Section of each satellite in [m^2]
+     */
+    const double *area{};
+
+    /**
+     * The ejection velocity of each satellite in [m/s]
+     */
+    const std::array<double, 3> *ejectionVelocity{};
+
+    /**
+     * The velocity of each satellite in [m/s]
+     */
+    const std::array<double, 3> *velocity{};
+
+    /**
+     * The number of Satellites
+     */
+    size_t count{};
+
+    /**
+     * Returns the size of this element.
+     * @return size
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * Returns the name of one Satellite by resolving its parent index.
+     * @param index - the position of the Satellite
+     * @return name
+     * @throws std::out_of_range if the parent index does not refer to an entry of the nameTable
+     */
+    const std::string &getName(size_t index) const {
+        return *nameTable.at(parent[index]);
+    }
+
+    /**
+     * Copies the viewed columns into an owning Satellites SoA.
+     * @return Satellites
+     */
+    Satellites toSatellites() const {
+        Satellites satellites{startId, satType, position, 0};
+        satellites.nameTable = nameTable;
+        satellites.parent.assign(parent, parent + count);
+        satellites.characteristicLength.assign(characteristicLength, characteristicLength + count);
+        satellites.areaToMassRatio.assign(areaToMassRatio, areaToMassRatio + count);
+        satellites.mass.assign(mass, mass + count);
+        satellites.area.assign(area, area + count);
+        satellites.ejectionVelocity.assign(ejectionVelocity, ejectionVelocity + count);
+        satellites.velocity.assign(velocity, velocity + count);
+        return satellites;
+    }
+
+};
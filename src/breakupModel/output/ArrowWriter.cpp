@@ -0,0 +1,378 @@
+#include "ArrowWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include "breakupModel/util/UtilityFlatBuffer.h"
+#include "breakupModel/util/UtilityFormat.h"
+
+namespace {
+
+    using util::flatbuffer::Builder;
+    using Offset = Builder::Offset;
+    using Table = Builder::Table;
+
+    /*
+     * Constants of the Arrow format (Schema.fbs, Message.fbs and File.fbs)
+     */
+
+    constexpr std::array<char, 6> MAGIC{{'A', 'R', 'R', 'O', 'W', '1'}};
+
+    constexpr std::uint32_t CONTINUATION = 0xFFFFFFFF;
+
+    constexpr std::int16_t METADATA_VERSION_V5 = 4;
+
+    constexpr std::uint8_t HEADER_SCHEMA = 1;
+    constexpr std::uint8_t HEADER_DICTIONARY_BATCH = 2;
+    constexpr std::uint8_t HEADER_RECORD_BATCH = 3;
+
+    constexpr std::uint8_t TYPE_INT = 2;
+    constexpr std::uint8_t TYPE_FLOATING_POINT = 3;
+    constexpr std::uint8_t TYPE_UTF8 = 5;
+    constexpr std::uint8_t TYPE_FIXED_SIZE_LIST = 16;
+
+    constexpr std::int16_t PRECISION_DOUBLE = 2;
+
+    /**
+     * The buffers in the body of a message start at multiples of this alignment
+     */
+    constexpr size_t BODY_ALIGNMENT = 64;
+
+    /**
+     * The id of the dictionary of the name column
+     */
+    constexpr std::int64_t NAME_DICTIONARY_ID = 0;
+
+    struct FieldNode {
+        std::int64_t length;
+        std::int64_t nullCount;
+    };
+
+    struct Buffer {
+        std::int64_t offset;
+        std::int64_t length;
+    };
+
+    struct Block {
+        std::int64_t offset;
+        std::int32_t metaDataLength;
+        std::int32_t padding;
+        std::int64_t bodyLength;
+    };
+
+    static_assert(sizeof(FieldNode) == 16 && sizeof(Buffer) == 16 && sizeof(Block) == 24,
+                  "The structs must match the Arrow schema");
+
+    /**
+     * A buffer of the body of a record batch which is written directly from the memory of the SoA.
+     */
+    struct BodyBuffer {
+        const void *data;
+        size_t length;
+    };
+
+    size_t alignTo(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    std::int16_t endianness() {
+        const std::uint16_t probe = 1;
+        std::uint8_t first;
+        std::memcpy(&first, &probe, 1);
+        return first == 1 ? 0 : 1;
+    }
+
+    Offset intType(Builder &builder, std::int32_t bitWidth, bool isSigned) {
+        return builder.addTable(Table{}.scalar<std::int32_t>(0, bitWidth).scalar<bool>(1, isSigned));
+    }
+
+    Offset field(Builder &builder, const std::string &name, std::uint8_t typeId, Offset type,
+                 const std::vector<Offset> &children = {}, std::optional<Offset> dictionary = std::nullopt) {
+        Table table{};
+        table.offset(0, builder.addString(name))
+                .scalar<bool>(1, false)
+                .scalar<std::uint8_t>(2, typeId)
+                .offset(3, type)
+                .offset(5, builder.addVector(children));
+        if (dictionary.has_value()) {
+            table.offset(4, *dictionary);
+        }
+        return builder.addTable(std::move(table));
+    }
+
+    Offset doubleField(Builder &builder, const std::string &name) {
+        return field(builder, name, TYPE_FLOATING_POINT,
+                     builder.addTable(Table{}.scalar<std::int16_t>(0, PRECISION_DOUBLE)));
+    }
+
+    Offset vectorField(Builder &builder, const std::string &name) {
+        return field(builder, name, TYPE_FIXED_SIZE_LIST, builder.addTable(Table{}.scalar<std::int32_t>(0, 3)),
+                     {doubleField(builder, "item")});
+    }
+
+    Offset keyValue(Builder &builder, const std::string &key, const std::string &value) {
+        return builder.addTable(Table{}.offset(0, builder.addString(key)).offset(1, builder.addString(value)));
+    }
+
+    /**
+     * Adds the schema: id, name (dictionary encoded), L_c, A/M, mass, area, ejection velocity, velocity.
+     */
+    Offset schema(Builder &builder, SatType satType, const std::array<double, 3> &position) {
+        const Offset nameDictionary = builder.addTable(Table{}
+                                                               .scalar<std::int64_t>(0, NAME_DICTIONARY_ID)
+                                                               .offset(1, intType(builder, 8, false))
+                                                               .scalar<bool>(2, false));
+        const std::vector<Offset> fields{
+                field(builder, "id", TYPE_INT, intType(builder, 64, false)),
+                field(builder, "name", TYPE_UTF8, builder.addTable(Table{}), {}, nameDictionary),
+                doubleField(builder, "characteristicLength"),
+                doubleField(builder, "areaToMassRatio"),
+                doubleField(builder, "mass"),
+                doubleField(builder, "area"),
+                vectorField(builder, "ejectionVelocity"),
+                vectorField(builder, "velocity")
+        };
+        std::string positionString{};
+        util::appendArray(positionString, position);
+        const std::vector<Offset> metadata{
+                keyValue(builder, "satType", Satellite::satTypeToString.at(satType)),
+                keyValue(builder, "position", positionString)
+        };
+        return builder.addTable(Table{}
+                                        .scalar<std::int16_t>(0, endianness())
+                                        .offset(1, builder.addVector(fields))
+                                        .offset(2, builder.addVector(metadata)));
+    }
+
+    /**
+     * Adds a RecordBatch table describing the given buffers, which are placed one after another in the body.
+     * @return the RecordBatch and the length of the body
+     */
+    std::pair<Offset, size_t> recordBatch(Builder &builder, size_t length,
+                                          const std::vector<FieldNode> &nodes,
+                                          const std::vector<BodyBuffer> &bodyBuffers) {
+        std::vector<Buffer> buffers{};
+        size_t bodyLength = 0;
+        for (const auto &bodyBuffer : bodyBuffers) {
+            buffers.push_back(Buffer{static_cast<std::int64_t>(bodyLength),
+                                     static_cast<std::int64_t>(bodyBuffer.length)});
+            bodyLength += alignTo(bodyBuffer.length, BODY_ALIGNMENT);
+        }
+        const Offset batch = builder.addTable(Table{}
+                                                      .scalar<std::int64_t>(0, static_cast<std::int64_t>(length))
+                                                      .offset(1, builder.addStructVector(nodes))
+                                                      .offset(2, builder.addStructVector(buffers)));
+        return {batch, bodyLength};
+    }
+
+}
+
+/**
+ * Writes the parts of an Arrow IPC file: magic, schema, dictionary, record batches and the footer.
+ */
+class ArrowWriter::ArrowFile {
+
+    std::ofstream _file;
+
+    /**
+     * The number of bytes written so far
+     */
+    size_t _position{0};
+
+    SatType _satType;
+
+    std::array<double, 3> _position3;
+
+    std::vector<std::shared_ptr<const std::string>> _nameTable;
+
+    std::vector<Block> _dictionaries;
+
+    std::vector<Block> _recordBatches;
+
+public:
+
+    /**
+     * Opens the file and writes the schema and the name dictionary of the given Satellites.
+     */
+    ArrowFile(const std::string &filename, const Satellites &satellites)
+            : _file{filename, std::ios::binary | std::ios::trunc},
+              _satType{satellites.satType},
+              _position3{satellites.position},
+              _nameTable{satellites.nameTable} {
+        if (!_file.is_open()) {
+            throw std::runtime_error{"The file " + filename + " could not be opened for writing!"};
+        }
+        write(MAGIC.data(), MAGIC.size());
+        writePadding(8);
+
+        Builder schemaBuilder{};
+        writeMessage(schemaBuilder, HEADER_SCHEMA, schema(schemaBuilder, _satType, _position3), 0, {});
+
+        //The dictionary of the name column: the name table as UTF-8 strings
+        std::vector<std::int32_t> offsets{0};
+        std::string characters{};
+        for (const auto &name : _nameTable) {
+            characters.append(*name);
+            offsets.push_back(static_cast<std::int32_t>(characters.size()));
+        }
+        const std::vector<BodyBuffer> bodyBuffers{
+                {nullptr, 0},
+                {offsets.data(), offsets.size() * sizeof(std::int32_t)},
+                {characters.data(), characters.size()}
+        };
+        Builder builder{};
+        auto[batch, bodyLength] = recordBatch(builder, _nameTable.size(),
+                                              {{static_cast<std::int64_t>(_nameTable.size()), 0}}, bodyBuffers);
+        const Offset dictionaryBatch = builder.addTable(Table{}
+                                                                .scalar<std::int64_t>(0, NAME_DICTIONARY_ID)
+                                                                .offset(1, batch)
+                                                                .scalar<bool>(2, false));
+        _dictionaries.push_back(writeMessage(builder, HEADER_DICTIONARY_BATCH, dictionaryBatch, bodyLength,
+                                             bodyBuffers));
+    }
+
+    /**
+     * Returns the name table the dictionary was written from.
+     * @return name table
+     */
+    const std::vector<std::shared_ptr<const std::string>> &getNameTable() const {
+        return _nameTable;
+    }
+
+    /**
+     * Writes the Satellites as one record batch.
+     */
+    void writeRecordBatch(const Satellites &satellites) {
+        const size_t size = satellites.size();
+        std::vector<std::uint64_t> ids(size);
+        for (size_t i = 0; i < size; ++i) {
+            ids[i] = satellites.startId + i;
+        }
+        const auto count = static_cast<std::int64_t>(size);
+        //Pre-order of the fields, the fixed size lists have a child node holding the components
+        const std::vector<FieldNode> nodes{{count, 0}, {count, 0}, {count, 0}, {count, 0}, {count, 0}, {count, 0},
+                                           {count, 0}, {3 * count, 0}, {count, 0}, {3 * count, 0}};
+        const size_t doubles = size * sizeof(double);
+        const size_t vectors = size * sizeof(std::array<double, 3>);
+        //No field contains nulls, so all validity bitmaps are empty
+        const BodyBuffer noValidity{nullptr, 0};
+        const std::vector<BodyBuffer> bodyBuffers{
+                noValidity, {ids.data(), size * sizeof(std::uint64_t)},
+                noValidity, {satellites.parent.data(), size},
+                noValidity, {satellites.characteristicLength.data(), doubles},
+                noValidity, {satellites.areaToMassRatio.data(), doubles},
+                noValidity, {satellites.mass.data(), doubles},
+                noValidity, {satellites.area.data(), doubles},
+                noValidity, noValidity, {satellites.ejectionVelocity.data(), vectors},
+                noValidity, noValidity, {satellites.velocity.data(), vectors}
+        };
+        Builder builder{};
+        auto[batch, bodyLength] = recordBatch(builder, size, nodes, bodyBuffers);
+        _recordBatches.push_back(writeMessage(builder, HEADER_RECORD_BATCH, batch, bodyLength, bodyBuffers));
+    }
+
+    /**
+     * Writes the end-of-stream marker and the footer.
+     */
+    void close() {
+        const std::array<std::uint32_t, 2> endOfStream{{CONTINUATION, 0}};
+        write(endOfStream.data(), sizeof(endOfStream));
+
+        Builder builder{};
+        const Offset footer = builder.addTable(Table{}
+                                                       .scalar<std::int16_t>(0, METADATA_VERSION_V5)
+                                                       .offset(1, schema(builder, _satType, _position3))
+                                                       .offset(2, builder.addStructVector(_dictionaries))
+                                                       .offset(3, builder.addStructVector(_recordBatches)));
+        const std::vector<std::uint8_t> bytes = builder.finish(footer);
+        write(bytes.data(), bytes.size());
+        const auto footerLength = static_cast<std::int32_t>(bytes.size());
+        write(&footerLength, sizeof(std::int32_t));
+        write(MAGIC.data(), MAGIC.size());
+        _file.close();
+        if (!_file) {
+            throw std::runtime_error{"The Arrow file could not be written!"};
+        }
+    }
+
+private:
+
+    void write(const void *data, size_t length) {
+        _file.write(static_cast<const char *>(data), static_cast<std::streamsize>(length));
+        _position += length;
+    }
+
+    void writePadding(size_t alignment) {
+        static constexpr std::array<char, BODY_ALIGNMENT> zeros{};
+        write(zeros.data(), alignTo(_position, alignment) - _position);
+    }
+
+    /**
+     * Writes an encapsulated message: continuation marker, metadata length, the Message FlatBuffer (padded so that
+     * the body starts aligned) and the body.
+     * @return the Block describing the message for the footer
+     */
+    Block writeMessage(Builder &builder, std::uint8_t headerType, Offset header, size_t bodyLength,
+                       const std::vector<BodyBuffer> &bodyBuffers) {
+        const Offset message = builder.addTable(Table{}
+                                                        .scalar<std::int16_t>(0, METADATA_VERSION_V5)
+                                                        .scalar<std::uint8_t>(1, headerType)
+                                                        .offset(2, header)
+                                                        .scalar<std::int64_t>(3, static_cast<std::int64_t>(bodyLength)));
+        std::vector<std::uint8_t> metadata = builder.finish(message);
+        const size_t offset = _position;
+        const size_t prefixLength = 2 * sizeof(std::uint32_t);
+        metadata.resize(alignTo(offset + prefixLength + metadata.size(), BODY_ALIGNMENT) - offset - prefixLength, 0);
+
+        const std::array<std::uint32_t, 2> prefix{{CONTINUATION, static_cast<std::uint32_t>(metadata.size())}};
+        write(prefix.data(), sizeof(prefix));
+        write(metadata.data(), metadata.size());
+        for (const auto &bodyBuffer : bodyBuffers) {
+            write(bodyBuffer.data, bodyBuffer.length);
+            writePadding(BODY_ALIGNMENT);
+        }
+        return Block{static_cast<std::int64_t>(offset), static_cast<std::int32_t>(prefixLength + metadata.size()), 0,
+                     static_cast<std::int64_t>(bodyLength)};
+    }
+
+};
+
+ArrowWriter::ArrowWriter(std::string filename)
+        : _filename{std::move(filename)} {}
+
+ArrowWriter::~ArrowWriter() = default;
+
+void ArrowWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    this->printResult(Satellites::fromAoS(satelliteCollection));
+}
+
+void ArrowWriter::printResult(const Satellites &satellites) const {
+    ArrowFile file{_filename, satellites};
+    file.writeRecordBatch(satellites);
+    file.close();
+}
+
+void ArrowWriter::consume(const Satellites &fragments) {
+    if (!_stream) {
+        _stream = std::make_unique<ArrowFile>(_filename, fragments);
+    }
+    const auto &nameTable = _stream->getNameTable();
+    if (!std::equal(nameTable.begin(), nameTable.end(), fragments.nameTable.begin(), fragments.nameTable.end(),
+                    [](const auto &lhs, const auto &rhs) { return *lhs == *rhs; })) {
+        throw std::runtime_error{"The Arrow output requires the same names in every block of fragments!"};
+    }
+    _stream->writeRecordBatch(fragments);
+}
+
+void ArrowWriter::finish() {
+    if (!_stream) {
+        //Without any block the file still gets its schema and footer, so it is a valid empty table
+        _stream = std::make_unique<ArrowFile>(_filename, Satellites{0, SatType::DEBRIS, {0.0, 0.0, 0.0}, 0});
+    }
+    _stream->close();
+    _stream.reset();
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "OutputWriter.h"
+#include "FragmentSink.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+
+/**
+ * This class prints the result of a Breakup event into a file in the Apache Arrow IPC file format
+ * (https://arrow.apache.org/docs/format/Columnar.html#ipc-file-format), which can be memory mapped by pyarrow,
+ * pandas or polars without any parsing. The format is written by hand, no Arrow library is required.
+ * The columns of the Satellites SoA are written as they are: the velocities as fixed size lists of three doubles,
+ * the names as a dictionary encoded column whose indices are the parent indices and whose dictionary is the name
+ * table. The shared type and position are stored in the metadata of the schema.
+ * The class can also be used as FragmentSink of a streamed Breakup, then every block becomes one record batch.
+ * @note Like the Satellites SoA the format requires consecutive IDs and a shared type and position, so an AoS is only
+ * accepted if it fulfills these requirements (see Satellites::fromAoS).
+ */
+class ArrowWriter : public OutputWriter, public FragmentSink {
+
+    /**
+     * The state of a file while it is written, defined in the translation unit
+     */
+    class ArrowFile;
+
+    const std::string _filename;
+
+    /**
+     * The file receiving the record batches in the streaming mode
+     */
+    std::unique_ptr<ArrowFile> _stream;
+
+public:
+
+    /**
+     * Creates a new ArrowWriter.
+     * Results are written to "breakupResult.arrow".
+     */
+    ArrowWriter() : ArrowWriter("breakupResult.arrow") {}
+
+    /**
+     * Creates a new ArrowWriter.
+     * Results are written to filename.
+     * @param filename - a string
+     */
+    explicit ArrowWriter(std::string filename);
+
+    ~ArrowWriter() override;
+
+    using OutputWriter::printResult;
+
+    /**
+     * Prints an AoS after converting it to a Satellites SoA.
+     * @param satelliteCollection
+     * @throws std::invalid_argument if the AoS cannot be represented by one Satellites SoA (see Satellites::fromAoS)
+     */
+    void printResult(const std::vector<Satellite> &satelliteCollection) const override;
+
+    void printResult(const Satellites &satellites) const override;
+
+    /**
+     * Writes the block as one record batch, the first block also determines the schema and the name dictionary.
+     * @param fragments - the next block of fragments
+     * @throws std::runtime_error if a block has a different name table than the first one
+     */
+    void consume(const Satellites &fragments) override;
+
+    /**
+     * Writes the footer. If no block was consumed, the file contains the schema (with the type DEBRIS and the origin
+     * as position) and no record batch.
+     */
+    void finish() override;
+
+};
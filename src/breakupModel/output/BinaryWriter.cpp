@@ -0,0 +1,113 @@
+#include "BinaryWriter.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+
+namespace {
+
+    /**
+     * One column to write: its description and the pointer to its first byte.
+     */
+    struct ColumnData {
+        util::binary::ColumnEntry entry;
+        const char *data;
+    };
+
+    ColumnData makeColumn(const char *name, util::binary::ColumnType type, std::uint32_t components,
+                          const void *data, std::size_t byteSize) {
+        ColumnData column{};
+        std::strncpy(column.entry.name.data(), name, column.entry.name.size() - 1);
+        column.entry.type = type;
+        column.entry.components = components;
+        column.entry.byteSize = byteSize;
+        column.data = static_cast<const char *>(data);
+        return column;
+    }
+
+    void writePadding(std::ostream &stream, std::size_t count) {
+        static constexpr std::array<char, util::binary::ALIGNMENT> zeros{};
+        stream.write(zeros.data(), static_cast<std::streamsize>(count));
+    }
+
+}
+
+void BinaryWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    this->printResult(Satellites::fromAoS(satelliteCollection));
+}
+
+void BinaryWriter::printResult(const Satellites &satellites) const {
+    if (_stream) {
+        write(*_stream, satellites);
+        if (!*_stream) {
+            throw std::runtime_error{"The binary result could not be written to the stream!"};
+        }
+        return;
+    }
+    std::ofstream file{_filename, std::ios::binary | std::ios::trunc};
+    if (!file.is_open()) {
+        throw std::runtime_error{"The file " + _filename + " could not be opened for writing!"};
+    }
+    write(file, satellites);
+    if (!file) {
+        throw std::runtime_error{"The file " + _filename + " could not be written!"};
+    }
+}
+
+void BinaryWriter::write(std::ostream &stream, const Satellites &satellites) {
+    using namespace util::binary;
+    const std::size_t size = satellites.size();
+    std::vector<ColumnData> columns{
+            makeColumn("parent", ColumnType::UINT8, 1, satellites.parent.data(), size),
+            makeColumn("characteristicLength", ColumnType::FLOAT64, 1, satellites.characteristicLength.data(),
+                       size * sizeof(double)),
+            makeColumn("areaToMassRatio", ColumnType::FLOAT64, 1, satellites.areaToMassRatio.data(),
+                       size * sizeof(double)),
+            makeColumn("mass", ColumnType::FLOAT64, 1, satellites.mass.data(), size * sizeof(double)),
+            makeColumn("area", ColumnType::FLOAT64, 1, satellites.area.data(), size * sizeof(double)),
+            makeColumn("ejectionVelocity", ColumnType::FLOAT64, 3, satellites.ejectionVelocity.data(),
+                       size * sizeof(std::array<double, 3>)),
+            makeColumn("velocity", ColumnType::FLOAT64, 3, satellites.velocity.data(),
+                       size * sizeof(std::array<double, 3>))
+    };
+
+    //Determine the layout: header | column table | name table | aligned columns
+    FileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.size = size;
+    header.startId = satellites.startId;
+    header.position = satellites.position;
+    header.satType = static_cast<std::uint32_t>(satellites.satType);
+    header.nameCount = static_cast<std::uint32_t>(satellites.nameTable.size());
+    header.columnCount = columns.size();
+    header.columnTableOffset = sizeof(FileHeader);
+    header.nameTableOffset = header.columnTableOffset + columns.size() * sizeof(ColumnEntry);
+    std::size_t offset = header.nameTableOffset;
+    for (const auto &name : satellites.nameTable) {
+        offset += sizeof(std::uint64_t) + name->size();
+    }
+    for (auto &column : columns) {
+        offset = align(offset);
+        column.entry.offset = offset;
+        offset += column.entry.byteSize;
+    }
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+    for (const auto &column : columns) {
+        stream.write(reinterpret_cast<const char *>(&column.entry), sizeof(ColumnEntry));
+    }
+    offset = header.nameTableOffset;
+    for (const auto &name : satellites.nameTable) {
+        const std::uint64_t length = name->size();
+        stream.write(reinterpret_cast<const char *>(&length), sizeof(std::uint64_t));
+        stream.write(name->data(), static_cast<std::streamsize>(length));
+        offset += sizeof(std::uint64_t) + length;
+    }
+    for (const auto &column : columns) {
+        writePadding(stream, column.entry.offset - offset);
+        stream.write(column.data, static_cast<std::streamsize>(column.entry.byteSize));
+        offset = column.entry.offset + column.entry.byteSize;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "OutputWriter.h"
+#include <string>
+#include <vector>
+#include <ostream>
+#include <utility>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/util/UtilityBinary.h"
+
+/**
+ * This class prints the result of a Breakup event into the columnar binary format described in UtilityBinary.h.
+ * The columns of the Satellites SoA are written as they are, the shared properties only once. The file can be read
+ * back without copying by the BinaryResultReader.
+ * @note The format requires consecutive IDs and a shared type and position, so an AoS is only accepted if it fulfills
+ * these requirements (e.g. the AoS of a breakup result). The writer is no FragmentSink, the columns must be known
+ * completely before they can be written.
+ */
+class BinaryWriter : public OutputWriter {
+
+    const std::string _filename;
+
+    /**
+     * The stream the result is written to instead of the file, nullptr if the file is used
+     */
+    std::ostream *const _stream{nullptr};
+
+public:
+
+    /**
+     * Creates a new BinaryWriter.
+     * Results are written to "breakupResult.bin".
+     */
+    BinaryWriter() : BinaryWriter("breakupResult.bin") {}
+
+    /**
+     * Creates a new BinaryWriter.
+     * Results are written to filename.
+     * @param filename - a string
+     */
+    explicit BinaryWriter(std::string filename)
+            : _filename{std::move(filename)} {}
+
+    /**
+     * Creates a new BinaryWriter.
+     * Results are written to the given stream (e.g. an in-memory response) instead of a file.
+     * @param stream - a std::ostream which must outlive the writer
+     */
+    explicit BinaryWriter(std::ostream &stream)
+            : _stream{&stream} {}
+
+    ~BinaryWriter() override = default;
+
+    using OutputWriter::printResult;
+
+    /**
+     * Prints an AoS after converting it to a Satellites SoA.
+     * @param satelliteCollection
+     * @throws std::invalid_argument if the AoS cannot be represented by one Satellites SoA (see Satellites::fromAoS)
+     */
+    void printResult(const std::vector<Satellite> &satelliteCollection) const override;
+
+    void printResult(const Satellites &satellites) const override;
+
+private:
+
+    /**
+     * Writes the columnar format of the SoA to the stream.
+     * @param stream - the destination
+     * @param satellites - the SoA
+     */
+    static void write(std::ostream &stream, const Satellites &satellites);
+
+};
@@ -0,0 +1,54 @@
+#include "BufferedTextOutput.h"
+
+BufferedTextOutput::BufferedTextOutput(const std::string &filename)
+        : _fileBuffer(FILE_BUFFER_SIZE),
+          _file{std::make_unique<std::ofstream>()} {
+    _file->rdbuf()->pubsetbuf(_fileBuffer.data(), static_cast<std::streamsize>(_fileBuffer.size()));
+    _file->open(filename, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!_file->is_open()) {
+        throw std::runtime_error{"The output file " + filename + " could not be opened!"};
+    }
+    _stream = _file.get();
+}
+
+BufferedTextOutput::BufferedTextOutput(std::ostream &stream)
+        : _stream{&stream} {}
+
+BufferedTextOutput::BufferedTextOutput(std::shared_ptr<spdlog::logger> logger)
+        : _logger{std::move(logger)} {
+    _logger->set_pattern("%v");
+}
+
+BufferedTextOutput::~BufferedTextOutput() {
+    if (_logger) {
+        _logger->flush();
+        spdlog::drop(_logger->name());
+    }
+}
+
+void BufferedTextOutput::write(std::string_view text) {
+    if (text.empty()) {
+        return;
+    }
+    if (_stream) {
+        _stream->write(text.data(), static_cast<std::streamsize>(text.size()));
+    } else {
+        //The logger terminates every message with a line break itself
+        _logger->info("{}", text.substr(0, text.size() - 1));
+    }
+}
+
+void BufferedTextOutput::writeBinary(const void *data, size_t size) {
+    if (!_stream) {
+        throw std::runtime_error{"Raw binary data can only be written to a file!"};
+    }
+    _stream->write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+}
+
+void BufferedTextOutput::flush() {
+    if (_stream) {
+        _stream->flush();
+    } else {
+        _logger->flush();
+    }
+}
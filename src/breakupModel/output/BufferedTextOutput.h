@@ -0,0 +1,158 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <memory>
+#include <future>
+#include <algorithm>
+#include <execution>
+#include <thread>
+#include "breakupModel/util/UtilityZip.h"
+#include "spdlog/spdlog.h"
+
+/**
+ * Destination for large amounts of line based text, e.g. one CSV line per fragment.
+ * The lines are formatted in chunks in parallel and the chunks are written in order. While one wave of chunks is
+ * written, the next one is already formatted. The text is either written to a file with a large buffer or (e.g. for
+ * testing) given to a spdlog logger with one message per chunk instead of one message per line. It can also be written
+ * to a stream owned by the caller, e.g. a std::ostringstream collecting the response of the BreakupService.
+ */
+class BufferedTextOutput {
+
+public:
+
+    /**
+     * The number of lines formatted together by one task
+     */
+    static constexpr size_t CHUNK_SIZE = 4096;
+
+    /**
+     * The size of the buffer of the output file in bytes
+     */
+    static constexpr size_t FILE_BUFFER_SIZE = 1u << 22u;
+
+private:
+
+    /**
+     * The buffer of the file stream (must be declared before the stream, so that it is destroyed after it)
+     */
+    std::vector<char> _fileBuffer{};
+
+    /**
+     * The output file, empty if a logger is used
+     */
+    std::unique_ptr<std::ofstream> _file{};
+
+    /**
+     * The stream the text is written to (the output file or a stream of the caller), nullptr if a logger is used
+     */
+    std::ostream *_stream{nullptr};
+
+    /**
+     * The logger, empty if a file is used
+     */
+    std::shared_ptr<spdlog::logger> _logger{};
+
+public:
+
+    /**
+     * Creates a new BufferedTextOutput writing to a file. An existing file is truncated.
+     * @param filename - a string
+     * @throws an runtime_error if the file cannot be opened
+     */
+    explicit BufferedTextOutput(const std::string &filename);
+
+    /**
+     * Creates a new BufferedTextOutput writing to the given stream. The stream must outlive this object.
+     * @param stream - a std::ostream
+     */
+    explicit BufferedTextOutput(std::ostream &stream);
+
+    /**
+     * Creates a new BufferedTextOutput which gives the text to a logger.
+     * @param logger - a shared_ptr to a logger (the pattern is set to "%v")
+     */
+    explicit BufferedTextOutput(std::shared_ptr<spdlog::logger> logger);
+
+    /**
+     * Flushes the output and de-registers the logger (if one is used), to ensure that a similar logger can be
+     * constructed once again.
+     */
+    ~BufferedTextOutput();
+
+    /**
+     * Writes complete lines.
+     * @param text - one or more lines, each terminated by '\n'
+     */
+    void write(std::string_view text);
+
+    /**
+     * Writes raw bytes, e.g. the appended data of a VTK file.
+     * @param data - pointer to the bytes
+     * @param size - the number of bytes
+     * @throws a runtime_error if this output writes to a logger
+     */
+    void writeBinary(const void *data, size_t size);
+
+    /**
+     * Returns true if this output writes to a file or stream (and can therefore write raw bytes).
+     * @return true or false
+     */
+    [[nodiscard]] bool isFile() const {
+        return _stream != nullptr;
+    }
+
+    /**
+     * Formats and writes one line per row. The rows are formatted in parallel, the order of the lines is kept.
+     * @tparam FormatRow - callable with the signature void(std::string &line, size_t row) which appends the row
+     * without the terminating '\n'
+     * @param rowCount - the number of rows
+     * @param formatRow - the function appending a row
+     */
+    template<typename FormatRow>
+    void writeLines(size_t rowCount, FormatRow formatRow) {
+        const size_t chunkCount = (rowCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        //The number of chunks formatted at once, bounds the memory to a few chunks per thread
+        const size_t waveSize = 4 * std::max(1u, std::thread::hardware_concurrency());
+        std::vector<std::string> formatted{};
+        std::vector<std::string> written{};
+        std::future<void> writing{};
+        for (size_t waveBegin = 0; waveBegin < chunkCount; waveBegin += waveSize) {
+            const size_t waveEnd = std::min(chunkCount, waveBegin + waveSize);
+            formatted.resize(waveEnd - waveBegin);
+            auto chunkView = util::indexRange(waveEnd - waveBegin);
+            std::for_each(std::execution::par, chunkView.begin(), chunkView.end(), [&](auto tuple) {
+                auto [chunk] = tuple;
+                auto &text = formatted[chunk];
+                text.clear();
+                const size_t begin = (waveBegin + chunk) * CHUNK_SIZE;
+                const size_t end = std::min(rowCount, begin + CHUNK_SIZE);
+                for (size_t row = begin; row < end; ++row) {
+                    formatRow(text, row);
+                    text.push_back('\n');
+                }
+            });
+            //Write this wave while the next one is formatted
+            if (writing.valid()) {
+                writing.get();
+            }
+            std::swap(formatted, written);
+            writing = std::async(std::launch::async, [this, &written]() {
+                for (const auto &text : written) {
+                    this->write(text);
+                }
+            });
+        }
+        if (writing.valid()) {
+            writing.get();
+        }
+    }
+
+    /**
+     * Flushes the buffered text to the file or logger.
+     */
+    void flush();
+
+};
@@ -1,52 +1,5 @@
 #include "CSVPatternWriter.h"
 
-const std::map<char, std::function<void(const Satellite &sat,
-                                        std::stringstream &stream)>> CSVPatternWriter::functionMap{
-        {'I', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getId(); }},
-        {'n', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getName(); }},
-        {'t', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getSatType(); }},
-        {'L', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getCharacteristicLength(); }},
-        {'R', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getAreaToMassRatio(); }},
-        {'A', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getArea(); }},
-        {'m', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getMass(); }},
-        {'v', [](const Satellite &sat, std::stringstream &stream) -> void {
-            using util::operator<<;
-            stream << sat.getVelocity();
-        }},
-        {'j', [](const Satellite &sat, std::stringstream &stream) -> void {
-            using util::operator<<;
-            stream << sat.getEjectionVelocity();
-        }},
-        {'p', [](const Satellite &sat, std::stringstream &stream) -> void {
-            using util::operator<<;
-            stream << sat.getPosition();
-        }},
-        {'a', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getSemiMajorAxis();
-        }},
-        {'e', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getEccentricity();
-        }},
-        {'i', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getInclination(AngularUnit::RADIAN);
-        }},
-        {'W', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getLongitudeOfTheAscendingNode(AngularUnit::RADIAN);
-        }},
-        {'w', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getArgumentOfPeriapsis(AngularUnit::RADIAN);
-        }},
-        {'M', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::MEAN);
-        }},
-        {'E', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::ECCENTRIC);
-        }},
-        {'T', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::TRUE);
-        }}
-};
-
 const std::map<char, std::string> CSVPatternWriter::headerMap{
         {'I', "ID"},
         {'n', "Name"},
@@ -68,24 +21,131 @@ const std::map<char, std::string> CSVPatternWriter::headerMap{
         {'T', "True Anomaly [rad]"}
 };
 
+void CSVPatternWriter::parsePattern(const std::string &pattern) {
+    for (char c : pattern) {
+        _myHeader.push_back(headerMap.at(c));
+        _myColumns.push_back(c);
+    }
+}
+
 void CSVPatternWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
-    //Header
-    std::stringstream header{};
-    for (auto headerIt = _myHeader.begin(); headerIt != _myHeader.end() - 1; ++headerIt) {
-        header << *headerIt << ',';
+    this->printHeader();
+    this->printLines(satelliteCollection);
+    _output->flush();
+}
+
+void CSVPatternWriter::printResult(const Satellites &satellites) const {
+    this->printHeader();
+    this->printLines(satellites);
+    _output->flush();
+}
+
+void CSVPatternWriter::consume(const Satellites &fragments) {
+    if (!_headerPrinted) {
+        this->printHeader();
+        _headerPrinted = true;
+    }
+    this->printLines(fragments);
+}
+
+void CSVPatternWriter::finish() {
+    if (!_headerPrinted) {
+        this->printHeader();
+    }
+    _headerPrinted = false;
+    _output->flush();
+}
+
+void CSVPatternWriter::printHeader() const {
+    std::string header{};
+    for (auto headerIt = _myHeader.begin(); headerIt != _myHeader.end(); ++headerIt) {
+        if (headerIt != _myHeader.begin()) {
+            header.push_back(',');
+        }
+        header.append(*headerIt);
     }
-    header << _myHeader.back();
-    _logger->info(header.str());
+    header.push_back('\n');
+    _output->write(header);
+}
 
-    //CSV Lines
-    for (const auto &sat : satelliteCollection) {
-        std::stringstream stream{};
-        stream.precision(17);
-        for (auto funIt = _myToDo.begin(); funIt != _myToDo.end() - 1; ++funIt) {
-            (*funIt)(sat, stream);
-            stream << ',';
+void CSVPatternWriter::printLines(const std::vector<Satellite> &satelliteCollection) const {
+    _output->writeLines(satelliteCollection.size(), [&](std::string &line, size_t index) {
+        this->appendLine(line, satelliteCollection[index]);
+    });
+}
+
+void CSVPatternWriter::printLines(const Satellites &satellites) const {
+    _output->writeLines(satellites.size(), [&](std::string &line, size_t index) {
+        this->appendLine(line, SatellitesRow{satellites, index});
+    });
+}
+
+template<typename Row>
+void CSVPatternWriter::appendLine(std::string &line, const Row &row) const {
+    for (auto columnIt = _myColumns.begin(); columnIt != _myColumns.end(); ++columnIt) {
+        if (columnIt != _myColumns.begin()) {
+            line.push_back(',');
+        }
+        switch (*columnIt) {
+            case 'I':
+                util::appendNumber(line, row.getId());
+                break;
+            case 'n':
+                line.append(row.getName());
+                break;
+            case 't':
+                line.append(Satellite::satTypeToString.at(row.getSatType()));
+                break;
+            case 'L':
+                util::appendNumber(line, row.getCharacteristicLength());
+                break;
+            case 'R':
+                util::appendNumber(line, row.getAreaToMassRatio());
+                break;
+            case 'A':
+                util::appendNumber(line, row.getArea());
+                break;
+            case 'm':
+                util::appendNumber(line, row.getMass());
+                break;
+            case 'v':
+                util::appendArray(line, row.getVelocity());
+                break;
+            case 'j':
+                util::appendArray(line, row.getEjectionVelocity());
+                break;
+            case 'p':
+                util::appendArray(line, row.getPosition());
+                break;
+            case 'a':
+                util::appendNumber(line, row.getOrbitalElements().getSemiMajorAxis());
+                break;
+            case 'e':
+                util::appendNumber(line, row.getOrbitalElements().getEccentricity());
+                break;
+            case 'i':
+                util::appendNumber(line, row.getOrbitalElements().getInclination(AngularUnit::RADIAN));
+                break;
+            case 'W':
+                util::appendNumber(line, row.getOrbitalElements().getLongitudeOfTheAscendingNode(AngularUnit::RADIAN));
+                break;
+            case 'w':
+                util::appendNumber(line, row.getOrbitalElements().getArgumentOfPeriapsis(AngularUnit::RADIAN));
+                break;
+            case 'M':
+                util::appendNumber(line, row.getOrbitalElements().getAnomaly(AngularUnit::RADIAN,
+                                                                             OrbitalAnomalyType::MEAN));
+                break;
+            case 'E':
+                util::appendNumber(line, row.getOrbitalElements().getAnomaly(AngularUnit::RADIAN,
+                                                                             OrbitalAnomalyType::ECCENTRIC));
+                break;
+            case 'T':
+                util::appendNumber(line, row.getOrbitalElements().getAnomaly(AngularUnit::RADIAN,
+                                                                             OrbitalAnomalyType::TRUE));
+                break;
+            default:
+                break;
         }
-        _myToDo.back()(sat, stream);
-        _logger->info(stream.str());
     }
 }
@@ -1,19 +1,18 @@
 #pragma once
 
 #include "OutputWriter.h"
-#include <iostream>
+#include "FragmentSink.h"
+#include "BufferedTextOutput.h"
 #include <string>
-#include <sstream>
 #include <exception>
 #include <utility>
 #include <memory>
 #include <map>
-#include <functional>
+#include <optional>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
 #include "breakupModel/util/UtilityContainer.h"
-#include "spdlog/async.h"
-#include "spdlog/sinks/basic_file_sink.h"
-#include "spdlog/fmt/ostr.h"
+#include "breakupModel/util/UtilityFormat.h"
 #include "spdlog/spdlog.h"
 
 /**
@@ -30,13 +29,69 @@
  * "L" correspond to Characteristic Length<br>
  * THis would mean, we get a one column CSV with only the Characteristic Length
  */
-class CSVPatternWriter : public OutputWriter {
+class CSVPatternWriter : public OutputWriter, public FragmentSink {
 
     /**
-     * Map which contains all available functions for a specific char. Those functions are usually getter of Satellite.
-     * @example for 'A' --> satellite.getArea()
+     * One Satellite of an SoA, providing the same getters as the Satellite class.
+     * Like the Satellite class it calculates its Orbital Elements at most once.
      */
-    const static std::map<char, std::function<void(const Satellite &sat, std::stringstream &stream)>> functionMap;
+    struct SatellitesRow {
+
+        const Satellites &satellites;
+
+        size_t index;
+
+        mutable std::optional<OrbitalElements> orbitalElementsCache{std::nullopt};
+
+        [[nodiscard]] size_t getId() const {
+            return satellites.startId + index;
+        }
+
+        [[nodiscard]] const std::string &getName() const {
+            return satellites.getName(index);
+        }
+
+        [[nodiscard]] SatType getSatType() const {
+            return satellites.satType;
+        }
+
+        [[nodiscard]] double getCharacteristicLength() const {
+            return satellites.characteristicLength[index];
+        }
+
+        [[nodiscard]] double getAreaToMassRatio() const {
+            return satellites.areaToMassRatio[index];
+        }
+
+        [[nodiscard]] double getArea() const {
+            return satellites.area[index];
+        }
+
+        [[nodiscard]] double getMass() const {
+            return satellites.mass[index];
+        }
+
+        [[nodiscard]] const std::array<double, 3> &getVelocity() const {
+            return satellites.velocity[index];
+        }
+
+        [[nodiscard]] const std::array<double, 3> &getEjectionVelocity() const {
+            return satellites.ejectionVelocity[index];
+        }
+
+        [[nodiscard]] const std::array<double, 3> &getPosition() const {
+            return satellites.position;
+        }
+
+        [[nodiscard]] const OrbitalElements &getOrbitalElements() const {
+            if (!orbitalElementsCache.has_value()) {
+                orbitalElementsCache = Satellite::calculateOrbitalElements(satellites.position,
+                                                                           satellites.velocity[index]);
+            }
+            return orbitalElementsCache.value();
+        }
+
+    };
 
     /**
      * Map which contains all available names for a specific char.
@@ -45,10 +100,10 @@ class CSVPatternWriter : public OutputWriter {
     const static std::map<char, std::string> headerMap;
 
     /**
-     * Contains the functions to execute for each satellite print. We iterate over the whole vector and execute
-     * the functions for each satellite.
+     * Contains the pattern chars in the order of the columns. For each satellite every column is appended by a
+     * switch over the char (see appendLine()), so no function object is called per cell.
      */
-    std::vector<std::function<void(const Satellite &sat, std::stringstream &stream)>> _myToDo;
+    std::vector<char> _myColumns;
 
     /**
      * Contains the Header information, which is printed by iterating over the whole vector and printing the strings
@@ -57,9 +112,14 @@ class CSVPatternWriter : public OutputWriter {
     std::vector<std::string> _myHeader;
 
     /**
-     * The logger which is needed to write to a file sink
+     * The buffered destination of the lines
+     */
+    std::unique_ptr<BufferedTextOutput> _output;
+
+    /**
+     * States if the header was already printed while consuming fragment blocks
      */
-    std::shared_ptr<spdlog::logger> _logger;
+    bool _headerPrinted{false};
 
 public:
 
@@ -69,39 +129,65 @@ public:
      * @param pattern - the pattern (have a look at the headerMap, which char has which meaning)
      */
     CSVPatternWriter(const std::string &filename, const std::string &pattern)
-            : _logger{spdlog::basic_logger_mt<spdlog::async_factory>("CSVPatternWriter_" + filename, filename, true)},
-              _myToDo{} {
-        _logger->set_pattern("%v");
-        for (char c : pattern) {
-            _myToDo.push_back(functionMap.at(c));
-            _myHeader.push_back(headerMap.at(c));
-        }
+            : _output{std::make_unique<BufferedTextOutput>(filename)} {
+        this->parsePattern(pattern);
     }
 
     /**
-    * Creates a new CSVPatternWriter with a specific logger. This constructor is especially useful for testing if no
-    * asynchronous properties are wished.
+    * Creates a new CSVPatternWriter with a specific logger. This constructor is especially useful for testing.
     * @param logger - a shared_ptr to a logger
     * @param pattern - the pattern (have a look at the headerMap, which char has which meaning)
     */
     CSVPatternWriter(std::shared_ptr<spdlog::logger> logger, const std::string &pattern)
-            : _logger{std::move(logger)},
-              _myToDo{} {
-        _logger->set_pattern("%v");
-        for (char c : pattern) {
-            _myToDo.push_back(functionMap.at(c));
-            _myHeader.push_back(headerMap.at(c));
-        }
+            : _output{std::make_unique<BufferedTextOutput>(std::move(logger))} {
+        this->parsePattern(pattern);
     }
 
-    /**
-    * De-Registers the logger of the CSVPatternWriter, to ensure that a similar CSVPatternWriter
-     * can be constructed once again.
-    */
-    ~CSVPatternWriter() override {
-        spdlog::drop(_logger->name());
-    }
+    ~CSVPatternWriter() override = default;
+
+    using OutputWriter::printResult;
 
     void printResult(const std::vector<Satellite> &satelliteCollection) const override;
 
+    void printResult(const Satellites &satellites) const override;
+
+    void consume(const Satellites &fragments) override;
+
+    void finish() override;
+
+private:
+
+    /**
+     * Sets the columns and the header according to the pattern.
+     * @param pattern - the pattern
+     * @throws an out_of_range exception if the pattern contains an unknown char
+     */
+    void parsePattern(const std::string &pattern);
+
+    /**
+     * Prints the header line defined by the pattern.
+     */
+    void printHeader() const;
+
+    /**
+     * Prints one line per satellite defined by the pattern.
+     * @param satelliteCollection
+     */
+    void printLines(const std::vector<Satellite> &satelliteCollection) const;
+
+    /**
+     * Prints one line per satellite of the SoA defined by the pattern.
+     * @param satellites
+     */
+    void printLines(const Satellites &satellites) const;
+
+    /**
+     * Appends the line of one satellite defined by the pattern (without line break).
+     * @tparam Row - Satellite or SatellitesRow
+     * @param line - the string to append to
+     * @param row - the satellite
+     */
+    template<typename Row>
+    void appendLine(std::string &line, const Row &row) const;
+
 };
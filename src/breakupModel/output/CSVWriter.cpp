@@ -1,45 +1,109 @@
 #include "CSVWriter.h"
 
+namespace {
+
+    /**
+     * Appends the columns of a Satellite without Kepler elements, separated by commas (without line break).
+     */
+    void appendColumns(std::string &line, size_t id, const std::string &name, SatType satType,
+                       double characteristicLength, double areaToMassRatio, double area, double mass,
+                       const std::array<double, 3> &ejectionVelocity, const std::array<double, 3> &velocity,
+                       const std::array<double, 3> &position) {
+        util::appendNumber(line, id);
+        line.push_back(',');
+        line.append(name);
+        line.push_back(',');
+        line.append(Satellite::satTypeToString.at(satType));
+        for (double value : {characteristicLength, areaToMassRatio, area, mass}) {
+            line.push_back(',');
+            util::appendNumber(line, value);
+        }
+        for (const auto *array : {&ejectionVelocity, &velocity, &position}) {
+            line.push_back(',');
+            util::appendArray(line, *array);
+        }
+    }
+
+    /**
+     * Appends the Kepler elements, each preceded by a comma.
+     */
+    void appendKepler(std::string &line, const OrbitalElements &kepler) {
+        for (size_t i = 0; i < 6; ++i) {
+            line.push_back(',');
+            util::appendNumber(line, kepler[i]);
+        }
+    }
+
+}
+
 void CSVWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    this->printHeader();
+    this->printLines(satelliteCollection);
+    _output->flush();
+}
+
+void CSVWriter::printResult(const Satellites &satellites) const {
+    this->printHeader();
+    this->printLines(satellites);
+    _output->flush();
+}
+
+void CSVWriter::consume(const Satellites &fragments) {
+    if (!_headerPrinted) {
+        this->printHeader();
+        _headerPrinted = true;
+    }
+    this->printLines(fragments);
+}
+
+void CSVWriter::finish() {
+    if (!_headerPrinted) {
+        this->printHeader();
+    }
+    _headerPrinted = false;
+    _output->flush();
+}
+
+void CSVWriter::printHeader() const {
     if (_withKepler) {
-        this->printKepler(satelliteCollection);
+        _output->write("ID,Name,Satellite Type,Characteristic Length [m],A/M [m^2/kg],Area [m^2],Mass [kg],"
+                       "Ejection Velocity [m/s],Velocity [m/s],Position [m],"
+                       "Semi-Major-Axis [m],Eccentricity,Inclination [rad],Longitude of the ascending node [rad],"
+                       "Argument of periapsis [rad],Mean Anomaly [rad]\n");
     } else {
-        this->printStandard(satelliteCollection);
+        _output->write("ID,Name,Satellite Type,Characteristic Length [m],A/M [m^2/kg],Area [m^2],Mass [kg],"
+                       "Ejection Velocity [m/s],Velocity [m/s],Position [m]\n");
     }
 }
 
-void CSVWriter::printStandard(const std::vector<Satellite> &satelliteCollection) const {
-    _logger->info(
-            "ID,Name,Satellite Type,Characteristic Length [m],A/M [m^2/kg],Area [m^2],Mass [kg],"
-            "Ejection Velocity [m/s],Velocity [m/s],Position [m]");
-    for (const auto &sat : satelliteCollection) {
-        auto &j = sat.getEjectionVelocity();
-        auto &v = sat.getVelocity();
-        auto &p = sat.getPosition();
-        //Because of ADL the overload operator<< for arrays (in UtilityContainer) does not work here
-        //@related https://en.cppreference.com/w/cpp/language/adl
-        _logger->info("{},{},{},{},{},{},{},[{} {} {}],[{} {} {}],[{} {} {}]", sat.getId(), sat.getName(), sat.getSatType(),
-                      sat.getCharacteristicLength(), sat.getAreaToMassRatio(), sat.getArea(), sat.getMass(),
-                      j[0], j[1], j[2], v[0], v[1], v[2], p[0], p[1], p[2]);
-    }
+void CSVWriter::printLines(const std::vector<Satellite> &satelliteCollection) const {
+    _output->writeLines(satelliteCollection.size(), [&](std::string &line, size_t index) {
+        this->appendLine(line, satelliteCollection[index]);
+    });
 }
 
-void CSVWriter::printKepler(const std::vector<Satellite> &satelliteCollection) const {
-    _logger->info("ID,Name,Satellite Type,Characteristic Length [m],A/M [m^2/kg],Area [m^2],Mass [kg],"
-                  "Ejection Velocity [m/s],Velocity [m/s],Position [m],"
-                  "Semi-Major-Axis [m],Eccentricity,Inclination [rad],Longitude of the ascending node [rad],"
-                  "Argument of periapsis [rad],Mean Anomaly [rad]");
-    for (const auto &sat : satelliteCollection) {
-        auto &j = sat.getEjectionVelocity();
-        auto &v = sat.getVelocity();
-        auto &p = sat.getPosition();
-        auto kepler = sat.getOrbitalElements();
-        //Because of ADL the overload operator<< for arrays (in UtilityContainer) does not work here
-        //@related https://en.cppreference.com/w/cpp/language/adl
-        _logger->info("{},{},{},{},{},{},{},[{} {} {}],[{} {} {}],[{} {} {}],{},{},{},{},{},{}", sat.getId(), sat.getName(), sat.getSatType(),
-                      sat.getCharacteristicLength(), sat.getAreaToMassRatio(), sat.getArea(), sat.getMass(),
-                      j[0], j[1], j[2], v[0], v[1], v[2], p[0], p[1], p[2],
-                      kepler[0], kepler[1], kepler[2], kepler[3], kepler[4], kepler[5]);
+void CSVWriter::printLines(const Satellites &satellites) const {
+    _output->writeLines(satellites.size(), [&](std::string &line, size_t index) {
+        this->appendLine(line, satellites, index);
+    });
+}
+
+void CSVWriter::appendLine(std::string &line, const Satellite &sat) const {
+    appendColumns(line, sat.getId(), sat.getName(), sat.getSatType(), sat.getCharacteristicLength(),
+                  sat.getAreaToMassRatio(), sat.getArea(), sat.getMass(),
+                  sat.getEjectionVelocity(), sat.getVelocity(), sat.getPosition());
+    if (_withKepler) {
+        appendKepler(line, sat.getOrbitalElements());
     }
 }
 
+void CSVWriter::appendLine(std::string &line, const Satellites &satellites, size_t index) const {
+    //The position is shared by all Satellites of the SoA
+    appendColumns(line, satellites.startId + index, satellites.getName(index), satellites.satType,
+                  satellites.characteristicLength[index], satellites.areaToMassRatio[index],
+                  satellites.area[index], satellites.mass[index], satellites.ejectionVelocity[index],
+                  satellites.velocity[index], satellites.position);
+    if (_withKepler) {
+        appendKepler(line, Satellite::calculateOrbitalElements(satellites.position, satellites.velocity[index]));
+    }
+}
@@ -1,35 +1,42 @@
 #pragma once
 
 #include "OutputWriter.h"
-#include <iostream>
-#include <fstream>
+#include "FragmentSink.h"
+#include "BufferedTextOutput.h"
 #include <string>
 #include <exception>
 #include <utility>
 #include <memory>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
 #include "breakupModel/util/UtilityContainer.h"
-#include "spdlog/async.h"
-#include "spdlog/sinks/basic_file_sink.h"
-#include "spdlog/fmt/ostr.h"
+#include "breakupModel/util/UtilityFormat.h"
 #include "spdlog/spdlog.h"
 
 /**
- * By using spdlog, this class provides methods to print the result of an Breakup event into an CSV file.
- * @note The used Logger level is "info", so this should be activated at least if output is wished!
+ * This class provides methods to print the result of an Breakup event into an CSV file.
+ * The lines are formatted in parallel and written with a large buffer (see BufferedTextOutput), the numbers are printed
+ * in their shortest representation which reads back to exactly the same value.
+ * The class can also be used as FragmentSink of a streamed Breakup, then the header is printed once before the first
+ * block of fragments.
  */
-class CSVWriter : public OutputWriter {
+class CSVWriter : public OutputWriter, public FragmentSink {
 
     /**
-    * The logger to write to the file sink
-    */
-    std::shared_ptr<spdlog::logger> _logger;
+     * The buffered destination of the lines
+     */
+    std::unique_ptr<BufferedTextOutput> _output;
 
     /**
      * States if the output should contain the Orbital Elements
      */
     bool _withKepler;
 
+    /**
+     * States if the header was already printed while consuming fragment blocks
+     */
+    bool _headerPrinted{false};
+
 public:
 
     /**
@@ -45,46 +52,73 @@ public:
      * @param withKepler - if true Kepler elements are printed (default: false)
      */
     explicit CSVWriter(const std::string &filename, bool withKepler = false)
-            : _logger{spdlog::basic_logger_mt<spdlog::async_factory>("CSVWriter_" + filename, filename, true)},
-              _withKepler{withKepler} {
-        _logger->set_pattern("%v");
-    }
+            : _output{std::make_unique<BufferedTextOutput>(filename)},
+              _withKepler{withKepler} {}
 
     /**
-     * Creates a new CSVWriter with a custom logger. This constructor is especially useful for testing if no
-     * asynchronous properties are wished.
-     * Results are written to filename. Kepler elements are activated depending on the flag.
-     * @param logger - a shared_ptr to a logger
+     * Creates a new CSVWriter writing to the given stream (e.g. an in-memory response).
+     * Kepler elements are activated depending on the flag.
+     * @param stream - a std::ostream which must outlive the writer
      * @param withKepler - if true Kepler elements are printed (default: false)
      */
-    explicit CSVWriter(std::shared_ptr<spdlog::logger> logger, bool withKepler = false)
-            : _logger{std::move(logger)},
-              _withKepler{withKepler} {
-        _logger->set_pattern("%v");
-    }
+    explicit CSVWriter(std::ostream &stream, bool withKepler = false)
+            : _output{std::make_unique<BufferedTextOutput>(stream)},
+              _withKepler{withKepler} {}
 
     /**
-     * De-Registers the logger of the CSVWriter, to ensure that a similar CSVWriter can be constructed once again.
+     * Creates a new CSVWriter with a custom logger. This constructor is especially useful for testing.
+     * Kepler elements are activated depending on the flag.
+     * @param logger - a shared_ptr to a logger
+     * @param withKepler - if true Kepler elements are printed (default: false)
      */
-    ~CSVWriter() override{
-        spdlog::drop(_logger->name());
-    }
+    explicit CSVWriter(std::shared_ptr<spdlog::logger> logger, bool withKepler = false)
+            : _output{std::make_unique<BufferedTextOutput>(std::move(logger))},
+              _withKepler{withKepler} {}
+
+    ~CSVWriter() override = default;
+
+    using OutputWriter::printResult;
 
     void printResult(const std::vector<Satellite> &satelliteCollection) const override;
 
+    void printResult(const Satellites &satellites) const override;
+
+    void consume(const Satellites &fragments) override;
+
+    void finish() override;
+
 private:
 
     /**
-     * Prints the vector without Kepler elements.
-     * @param satelliteCollection
+     * Prints the header line, with or without Kepler elements.
      */
-    void printStandard(const std::vector<Satellite> &satelliteCollection) const;
+    void printHeader() const;
 
     /**
-     * Prints the vector with Kepler elements.
+     * Prints the lines of the vector, with or without Kepler elements.
      * @param satelliteCollection
      */
-    void printKepler(const std::vector<Satellite> &satelliteCollection) const;
+    void printLines(const std::vector<Satellite> &satelliteCollection) const;
 
-};
+    /**
+     * Prints the lines of the SoA, with or without Kepler elements.
+     * @param satellites
+     */
+    void printLines(const Satellites &satellites) const;
 
+    /**
+     * Appends the line of one Satellite (without line break).
+     * @param line - the string to append to
+     * @param sat - the Satellite
+     */
+    void appendLine(std::string &line, const Satellite &sat) const;
+
+    /**
+     * Appends the line of one Satellite of an SoA (without line break).
+     * @param line - the string to append to
+     * @param satellites - the SoA
+     * @param index - the position of the Satellite in the SoA
+     */
+    void appendLine(std::string &line, const Satellites &satellites, size_t index) const;
+
+};
@@ -0,0 +1,21 @@
+#include "EnsembleStatisticsWriter.h"
+
+void EnsembleStatisticsWriter::printResult(const EnsembleStatistics &statistics) const {
+    const size_t realizations = statistics.getRealizationCount();
+    _logger->info("Quantity,Bin Lower,Bin Upper,Realizations,Count Mean,Count Variance,Mass Mean [kg],"
+                  "Mass Variance [kg^2]");
+    for (const auto &histogram : statistics.getHistograms()) {
+        for (size_t bin = 0; bin < histogram.count.size(); ++bin) {
+            _logger->info("{},{},{},{},{},{},{},{}", histogram.name,
+                          histogram.binning.lowerBound(bin), histogram.binning.upperBound(bin), realizations,
+                          histogram.count[bin].getMean(), histogram.count[bin].getVariance(),
+                          histogram.mass[bin].getMean(), histogram.mass[bin].getVariance());
+        }
+    }
+    //The totals of a realization are not binned
+    const auto &count = statistics.getFragmentCount();
+    const auto &mass = statistics.getFragmentMass();
+    _logger->info("Total,,,{},{},{},{},{}", realizations, count.getMean(), count.getVariance(),
+                  mass.getMean(), mass.getVariance());
+    _logger->flush();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <utility>
+#include "breakupModel/simulation/EnsembleStatistics.h"
+#include "spdlog/async.h"
+#include "spdlog/sinks/basic_file_sink.h"
+#include "spdlog/spdlog.h"
+
+/**
+ * By using spdlog, this class prints the aggregated statistics of an ensemble into a compact CSV file.
+ * Every line describes one bin of one fragment property with mean and variance (over the realizations) of the
+ * number and the mass of the fragments in this bin. The last line ("Total") contains the statistics of the total
+ * fragment count and mass per realization.
+ * The quantities in the first column are named like the corresponding columns of the CSVWriter. The underflow and
+ * overflow bins have the bounds [0, lower] and [upper, inf].
+ * @note The used Logger level is "info", so this should be activated at least if output is wished!
+ */
+class EnsembleStatisticsWriter {
+
+    /**
+     * The logger to write to the file sink
+     */
+    std::shared_ptr<spdlog::logger> _logger;
+
+public:
+
+    /**
+     * Creates a new EnsembleStatisticsWriter.
+     * Results are written to filename.
+     * @param filename - a string
+     */
+    explicit EnsembleStatisticsWriter(const std::string &filename)
+            : _logger{spdlog::basic_logger_mt<spdlog::async_factory>("EnsembleStatisticsWriter_" + filename,
+                                                                     filename, true)} {
+        _logger->set_pattern("%v");
+    }
+
+    /**
+     * Creates a new EnsembleStatisticsWriter with a custom logger. This constructor is especially useful for testing
+     * if no asynchronous properties are wished.
+     * @param logger - a shared_ptr to a logger
+     */
+    explicit EnsembleStatisticsWriter(std::shared_ptr<spdlog::logger> logger)
+            : _logger{std::move(logger)} {
+        _logger->set_pattern("%v");
+    }
+
+    /**
+     * De-Registers the logger, to ensure that a similar EnsembleStatisticsWriter can be constructed once again.
+     */
+    ~EnsembleStatisticsWriter() {
+        spdlog::drop(_logger->name());
+    }
+
+    /**
+     * Prints the statistics.
+     * @param statistics - the aggregated realizations of an ensemble
+     */
+    void printResult(const EnsembleStatistics &statistics) const;
+
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "breakupModel/model/Satellites.h"
+
+/**
+ * Interface for the consumers of a streamed breakup simulation (Pure virtual).
+ * In the streaming mode the Breakup does not hold all fragments at once, instead it pushes every finished block of
+ * fragments to its sinks. The blocks arrive in the order of the fragment IDs.
+ */
+class FragmentSink {
+
+public:
+
+    FragmentSink() = default;
+
+    virtual ~FragmentSink() = default;
+
+    /**
+     * Consumes one block of fragments. The block is only valid during this call.
+     * @param fragments - the next block of fragments
+     */
+    virtual void consume(const Satellites &fragments) = 0;
+
+    /**
+     * Called after the last block was consumed.
+     * Default implemented: does nothing.
+     */
+    virtual void finish() {}
+
+};
@@ -3,6 +3,7 @@
 #include <vector>
 #include <string>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
 #include "breakupModel/simulation/Breakup.h"
 
 /**
@@ -22,13 +23,22 @@ public:
      */
     virtual void printResult(const std::vector<Satellite> &satelliteCollection) const = 0;
 
+    /**
+     * Prints the Satellites of an SoA to an output source.
+     * Default implemented: converts the SoA to an AoS, writers should override this to print the columns directly.
+     * @param satellites
+     */
+    virtual void printResult(const Satellites &satellites) const {
+        this->printResult(satellites.getAoS());
+    }
+
     /**
      * Prints the result Satellites to an output source.
      * Default implemented.
      * @param breakup
      */
     virtual void printResult(const Breakup &breakup) const {
-        this->printResult(breakup.getResult());
+        this->printResult(breakup.getResultSoA());
     }
 
 };
@@ -0,0 +1,22 @@
+#include "StatisticsSink.h"
+
+void StatisticsSink::consume(const Satellites &fragments) {
+    _count += fragments.size();
+    _mass = std::accumulate(fragments.mass.begin(), fragments.mass.end(), _mass);
+    for (double lc : fragments.characteristicLength) {
+        _minCharacteristicLength = std::min(_minCharacteristicLength, lc);
+        _maxCharacteristicLength = std::max(_maxCharacteristicLength, lc);
+    }
+    for (const auto &ejectionVelocity : fragments.ejectionVelocity) {
+        _ejectionVelocitySum += util::euclideanNorm(ejectionVelocity);
+    }
+}
+
+void StatisticsSink::finish() {
+    spdlog::info("The simulation produced {} fragments with a mass of {} kg", _count, _mass);
+    if (_count > 0) {
+        spdlog::info("The characteristic length of the fragments is in [{}, {}] m", _minCharacteristicLength,
+                     _maxCharacteristicLength);
+        spdlog::info("The mean ejection velocity of the fragments is {} m/s", getMeanEjectionVelocity());
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "FragmentSink.h"
+
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/util/UtilityContainer.h"
+#include "spdlog/spdlog.h"
+
+/**
+ * FragmentSink which does not store the fragments but only summarizes them.
+ * At the end of the stream the summary is printed with the info level of the default logger.
+ */
+class StatisticsSink : public FragmentSink {
+
+    /**
+     * The number of consumed fragments
+     */
+    size_t _count{0};
+
+    /**
+     * The mass sum of the consumed fragments in [kg]
+     */
+    double _mass{0.0};
+
+    /**
+     * The minimal characteristic length of the consumed fragments in [m]
+     */
+    double _minCharacteristicLength{std::numeric_limits<double>::infinity()};
+
+    /**
+     * The maximal characteristic length of the consumed fragments in [m]
+     */
+    double _maxCharacteristicLength{0.0};
+
+    /**
+     * The sum of the absolute ejection velocities of the consumed fragments in [m/s]
+     */
+    double _ejectionVelocitySum{0.0};
+
+public:
+
+    void consume(const Satellites &fragments) override;
+
+    void finish() override;
+
+    [[nodiscard]] size_t getCount() const {
+        return _count;
+    }
+
+    [[nodiscard]] double getMass() const {
+        return _mass;
+    }
+
+    [[nodiscard]] double getMinCharacteristicLength() const {
+        return _minCharacteristicLength;
+    }
+
+    [[nodiscard]] double getMaxCharacteristicLength() const {
+        return _maxCharacteristicLength;
+    }
+
+    /**
+     * Returns the mean of the absolute ejection velocities.
+     * @return mean ejection velocity in [m/s], zero if nothing was consumed
+     */
+    [[nodiscard]] double getMeanEjectionVelocity() const {
+        return _count == 0 ? 0.0 : _ejectionVelocitySum / static_cast<double>(_count);
+    }
+
+};
@@ -1,48 +1,321 @@
 #include "VTKWriter.h"
 
-void VTKWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
-    //Header
-    this->printHeader(satelliteCollection.size());
+const std::map<std::string, VTKFormat> VTKWriter::stringToVTKFormat{
+        {"ascii",    VTKFormat::ASCII},
+        {"base64",   VTKFormat::BASE64},
+        {"appended", VTKFormat::APPENDED}
+};
 
-    //Point properties
-    this->printProperty<double, Satellite>("characteristic-length", &Satellite::getCharacteristicLength, satelliteCollection);
-    this->printProperty<double, Satellite>("mass", &Satellite::getMass, satelliteCollection);
-    this->printProperty<double, Satellite>("area", &Satellite::getArea, satelliteCollection);
-    this->printProperty<double, Satellite>("area-to-mass", &Satellite::getAreaToMassRatio, satelliteCollection);
-    this->printProperty<std::array<double, 3>, Satellite>("velocity", &Satellite::getVelocity, satelliteCollection);
-    this->printProperty<std::array<double, 3>, Satellite>("ejection-velocity", &Satellite::getEjectionVelocity, satelliteCollection);
+const std::array<std::pair<const char *, size_t>, VTKWriter::COLUMN_COUNT> VTKWriter::columnLayout{{
+        {"characteristic-length", 1},
+        {"mass",                  1},
+        {"area",                  1},
+        {"area-to-mass",          1},
+        {"velocity",              3},
+        {"ejection-velocity",     3},
+        {"position",              3}
+}};
 
-    //Separator between point and point-tore-cell data
-    this->printSeparator();
+VTKWriter::VTKWriter(const std::string &filename, VTKFormat format, size_t pieceCount)
+        : _format{format},
+          _pieceCount{std::max<size_t>(1, pieceCount)} {
+    if (_pieceCount == 1) {
+        _output = std::make_unique<BufferedTextOutput>(filename);
+    } else {
+        _filenameStem = std::filesystem::path{filename}.replace_extension().string();
+        _output = std::make_unique<BufferedTextOutput>(_filenameStem + ".pvtu");
+    }
+}
 
-    //Point properties related to cell (position)
-    this->printProperty<std::array<double, 3>, Satellite>("position", &Satellite::getPosition, satelliteCollection);
+void VTKWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    if (_pieceCount > 1) {
+        this->printPartitioned(satelliteCollection, satelliteCollection.size());
+    } else {
+        this->printFile(satelliteCollection.size(), getColumns(satelliteCollection));
+    }
+}
 
-    //Footer
+void VTKWriter::printResult(const Satellites &satellites) const {
+    if (_pieceCount > 1) {
+        this->printPartitioned(satellites, satellites.size());
+    } else {
+        this->printFile(satellites.size(), getColumns(satellites));
+    }
+}
+
+void VTKWriter::consume(const Satellites &fragments) {
+    if (_pieceCount > 1) {
+        //Every block becomes its own piece file
+        this->printPieceFile(_consumedPieceCount++, fragments.size(), getColumns(fragments), _format);
+        return;
+    }
+    if (!_headerPrinted) {
+        this->printHeader();
+        _headerPrinted = true;
+    }
+    //Every block is a self-contained Piece, so the appended format falls back to inline base64
+    this->printPiece(fragments.size(), getColumns(fragments),
+                     _format == VTKFormat::ASCII ? VTKFormat::ASCII : VTKFormat::BASE64);
+}
+
+void VTKWriter::finish() {
+    if (_pieceCount > 1) {
+        this->printIndex(_consumedPieceCount);
+        _consumedPieceCount = 0;
+        return;
+    }
+    if (!_headerPrinted) {
+        this->printHeader();
+    }
     this->printFooter();
+    _headerPrinted = false;
+    _output->flush();
 }
 
-void VTKWriter::printHeader(size_t size) const {
-    _logger->info(R"(<?xml version="1.0" encoding="UTF-8" standalone="no" ?>)");
-    _logger->info(R"(<VTKFile byte_order="LittleEndian" type="UnstructuredGrid" version="0.1">)");
-    _logger->info(R"(  <UnstructuredGrid>)");
-    _logger->info(R"(    <Piece NumberOfCells="0" NumberOfPoints="{}">)", size);
-    _logger->info(R"(      <PointData>)");
+std::vector<VTKWriter::Column> VTKWriter::makeColumns(std::array<Column::Data, COLUMN_COUNT> data) {
+    std::vector<Column> columns{};
+    columns.reserve(COLUMN_COUNT);
+    for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+        columns.push_back(Column{columnLayout[i].first, columnLayout[i].second, std::move(data[i])});
+    }
+    return columns;
+}
+
+std::vector<VTKWriter::Column> VTKWriter::getColumns(const std::vector<Satellite> &satelliteCollection,
+                                                    size_t begin) {
+    //Gathers a property of a chunk of the Satellites into the buffer
+    auto scalar = [&satelliteCollection, begin](double (Satellite::*getter)() const) -> Column::Data {
+        return [&satelliteCollection, begin, getter](size_t first, size_t count, std::vector<double> &buffer) {
+            buffer.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                buffer[i] = (satelliteCollection[begin + first + i].*getter)();
+            }
+            return static_cast<const double *>(buffer.data());
+        };
+    };
+    auto vector = [&satelliteCollection, begin](
+            const std::array<double, 3> &(Satellite::*getter)() const) -> Column::Data {
+        return [&satelliteCollection, begin, getter](size_t first, size_t count, std::vector<double> &buffer) {
+            buffer.resize(3 * count);
+            for (size_t i = 0; i < count; ++i) {
+                const auto &array = (satelliteCollection[begin + first + i].*getter)();
+                std::copy(array.begin(), array.end(), buffer.begin() + 3 * i);
+            }
+            return static_cast<const double *>(buffer.data());
+        };
+    };
+    return makeColumns({scalar(&Satellite::getCharacteristicLength),
+                        scalar(&Satellite::getMass),
+                        scalar(&Satellite::getArea),
+                        scalar(&Satellite::getAreaToMassRatio),
+                        vector(&Satellite::getVelocity),
+                        vector(&Satellite::getEjectionVelocity),
+                        vector(&Satellite::getPosition)});
+}
+
+std::vector<VTKWriter::Column> VTKWriter::getColumns(const Satellites &satellites, size_t begin) {
+    //The columns of the SoA are used directly (std::array<double, 3> has no padding)
+    auto scalar = [begin](const std::vector<double> &column) -> Column::Data {
+        return [&column, begin](size_t first, size_t, std::vector<double> &) {
+            return column.data() + begin + first;
+        };
+    };
+    auto vector = [begin](const std::vector<std::array<double, 3>> &column) -> Column::Data {
+        return [&column, begin](size_t first, size_t, std::vector<double> &) {
+            return reinterpret_cast<const double *>(column.data() + begin + first);
+        };
+    };
+    return makeColumns({scalar(satellites.characteristicLength),
+                        scalar(satellites.mass),
+                        scalar(satellites.area),
+                        scalar(satellites.areaToMassRatio),
+                        vector(satellites.velocity),
+                        vector(satellites.ejectionVelocity),
+                        //The position is shared by all points of the SoA, it is only repeated for the chunk being
+                        //written
+                        [&satellites](size_t, size_t count, std::vector<double> &buffer) {
+                            buffer.resize(3 * count);
+                            for (size_t i = 0; i < count; ++i) {
+                                std::copy(satellites.position.begin(), satellites.position.end(),
+                                          buffer.begin() + 3 * i);
+                            }
+                            return static_cast<const double *>(buffer.data());
+                        }});
+}
+
+std::string VTKWriter::getPieceFilename(size_t piece) const {
+    return _filenameStem + "_" + std::to_string(piece) + ".vtu";
+}
+
+void VTKWriter::printPieceFile(size_t piece, size_t size, const std::vector<Column> &columns,
+                               VTKFormat format) const {
+    VTKWriter pieceWriter{getPieceFilename(piece), format};
+    pieceWriter.printFile(size, columns);
+}
+
+void VTKWriter::printIndex(size_t pieceCount) const {
+    const bool binary = _format != VTKFormat::ASCII;
+    const char *type = binary ? "Float64" : "Float32";
+    std::string index{"<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\" ?>\n"};
+    index.append(R"(<VTKFile byte_order=")").append(byteOrder())
+            .append(binary ? R"(" header_type="UInt64" type="PUnstructuredGrid" version="1.0">)"
+                           : R"(" type="PUnstructuredGrid" version="0.1">)")
+            .append("\n  <PUnstructuredGrid GhostLevel=\"0\">\n    <PPointData>\n");
+    for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+        if (i == COLUMN_COUNT - 1) {
+            index.append("    </PPointData>\n    <PPoints>\n");
+        }
+        const auto &[name, components] = columnLayout[i];
+        index.append(R"(      <PDataArray Name=")").append(name).append(R"(" NumberOfComponents=")");
+        util::appendNumber(index, components);
+        index.append(R"(" type=")").append(type).append("\"/>\n");
+    }
+    index.append("    </PPoints>\n");
+    for (size_t piece = 0; piece < pieceCount; ++piece) {
+        //The piece files are referenced relative to the index file
+        index.append(R"(    <Piece Source=")")
+                .append(std::filesystem::path{getPieceFilename(piece)}.filename().string())
+                .append("\"/>\n");
+    }
+    index.append("  </PUnstructuredGrid>\n</VTKFile>\n");
+    _output->write(index);
+    _output->flush();
+}
+
+void VTKWriter::printFile(size_t size, const std::vector<Column> &columns) const {
+    this->printHeader();
+    if (_format != VTKFormat::APPENDED) {
+        this->printPiece(size, columns, _format);
+        this->printFooter();
+        _output->flush();
+        return;
+    }
+
+    //The XML structure references the blocks of the appended data by their offset
+    //Each block consists of its size in bytes (UInt64) followed by the data
+    std::vector<std::uint64_t> blockSizes{};
+    std::string xml{};
+    std::uint64_t offset = 0;
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (i == columns.size() - 1) {
+            xml.append("      </PointData>\n      <CellData/>\n      <Points>\n");
+        }
+        xml.append(R"(        <DataArray Name=")").append(columns[i].name).append(R"(" NumberOfComponents=")");
+        util::appendNumber(xml, columns[i].components);
+        xml.append(R"(" format="appended" offset=")");
+        util::appendNumber(xml, offset);
+        xml.append("\" type=\"Float64\"/>\n");
+        blockSizes.push_back(size * columns[i].components * sizeof(double));
+        offset += sizeof(std::uint64_t) + blockSizes.back();
+    }
+    this->printPieceHeader(size);
+    _output->write(xml);
+    this->printPieceFooter();
+    _output->write("  </UnstructuredGrid>\n  <AppendedData encoding=\"raw\">\n   _");
+    std::vector<double> buffer{};
+    for (size_t i = 0; i < columns.size(); ++i) {
+        _output->writeBinary(&blockSizes[i], sizeof(std::uint64_t));
+        const size_t components = columns[i].components;
+        forEachChunk(size, columns[i], buffer, [this, components](const double *data, size_t count) {
+            _output->writeBinary(data, count * components * sizeof(double));
+        });
+    }
+    _output->write("\n  </AppendedData>\n</VTKFile>\n");
+    _output->flush();
+}
+
+void VTKWriter::printPiece(size_t size, const std::vector<Column> &columns, VTKFormat format) const {
+    this->printPieceHeader(size);
+    std::vector<double> buffer{};
+    for (size_t i = 0; i < columns.size(); ++i) {
+        //The last column is the position which belongs to the Points
+        if (i == columns.size() - 1) {
+            this->printSeparator();
+        }
+        this->printDataArray(size, columns[i], format, buffer);
+    }
+    this->printPieceFooter();
+}
+
+void VTKWriter::printDataArray(size_t size, const Column &column, VTKFormat format,
+                               std::vector<double> &buffer) const {
+    std::string tag{R"(        <DataArray Name=")"};
+    tag.append(column.name).append(R"(" NumberOfComponents=")");
+    util::appendNumber(tag, column.components);
+    tag.append(format == VTKFormat::ASCII ? R"(" format="ascii" type="Float32">)" : R"(" format="binary" type="Float64">)");
+    tag.push_back('\n');
+    _output->write(tag);
+
+    const size_t components = column.components;
+    if (format == VTKFormat::ASCII) {
+        forEachChunk(size, column, buffer, [this, components](const double *data, size_t count) {
+            _output->writeLines(count, [data, components](std::string &line, size_t index) {
+                line.append("          ");
+                for (size_t c = 0; c < components; ++c) {
+                    if (c != 0) {
+                        line.push_back(' ');
+                    }
+                    util::appendNumber(line, data[components * index + c]);
+                }
+            });
+        });
+    } else {
+        //Header (UInt64 number of bytes) and data are encoded as one stream, the encoder carries the incomplete
+        //groups of bytes from one chunk to the next
+        const std::uint64_t byteCount = size * components * sizeof(double);
+        std::string line{"          "};
+        util::Base64Encoder encoder{line};
+        encoder.append(&byteCount, sizeof(std::uint64_t));
+        forEachChunk(size, column, buffer, [&](const double *data, size_t count) {
+            encoder.append(data, count * components * sizeof(double));
+            //A file receives every encoded chunk right away, a logger needs the whole line as one message
+            if (_output->isFile()) {
+                _output->writeBinary(line.data(), line.size());
+                line.clear();
+            }
+        });
+        encoder.finish();
+        line.push_back('\n');
+        _output->write(line);
+    }
+    _output->write("        </DataArray>\n");
+}
+
+void VTKWriter::printHeader() const {
+    _output->write("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\" ?>\n");
+    if (_format == VTKFormat::ASCII) {
+        _output->write(R"(<VTKFile byte_order="LittleEndian" type="UnstructuredGrid" version="0.1">)" "\n");
+    } else {
+        _output->write(std::string{R"(<VTKFile byte_order=")"} + byteOrder()
+                       + R"(" header_type="UInt64" type="UnstructuredGrid" version="1.0">)" + "\n");
+    }
+    _output->write("  <UnstructuredGrid>\n");
+}
+
+void VTKWriter::printPieceHeader(size_t size) const {
+    std::string header{R"(    <Piece NumberOfCells="0" NumberOfPoints=")"};
+    util::appendNumber(header, size);
+    header.append("\">\n      <PointData>\n");
+    _output->write(header);
 }
 
 void VTKWriter::printSeparator() const {
-    _logger->info(R"(      </PointData>)");
-    _logger->info(R"(      <CellData/>)");
-    _logger->info(R"(      <Points>)");
+    _output->write("      </PointData>\n      <CellData/>\n      <Points>\n");
+}
+
+void VTKWriter::printPieceFooter() const {
+    _output->write("      </Points>\n"
+                   "      <Cells>\n"
+                   R"(        <DataArray Name="types" NumberOfComponents="0" format="ascii" type="Float32"/>)" "\n"
+                   "      </Cells>\n"
+                   "    </Piece>\n");
 }
 
 void VTKWriter::printFooter() const {
-    _logger->info(R"(      </Points>)");
-    _logger->info(R"(      <Cells>)");
-    _logger->info(R"(        <DataArray Name="types" NumberOfComponents="0" format="ascii" type="Float32"/>)");
-    _logger->info(R"(      </Cells>)");
-    _logger->info(R"(    </Piece>)");
-    _logger->info(R"(  </UnstructuredGrid>)");
-    _logger->info(R"(</VTKFile>)");
+    _output->write("  </UnstructuredGrid>\n</VTKFile>\n");
 }
 
+const char *VTKWriter::byteOrder() {
+    const std::uint16_t probe = 1;
+    return *reinterpret_cast<const unsigned char *>(&probe) == 1 ? "LittleEndian" : "BigEndian";
+}
@@ -1,108 +1,328 @@
 #pragma once
 
 #include "OutputWriter.h"
+#include "FragmentSink.h"
+#include "BufferedTextOutput.h"
 
 #include <string>
 #include <functional>
 #include <utility>
+#include <memory>
+#include <vector>
+#include <map>
+#include <array>
+#include <exception>
+#include <algorithm>
+#include <execution>
+#include <filesystem>
 #include "breakupModel/model/Satellite.h"
-#include "spdlog/async.h"
-#include "spdlog/sinks/basic_file_sink.h"
-#include "spdlog/fmt/ostr.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/util/UtilityFormat.h"
+#include "breakupModel/util/UtilityZip.h"
 #include "spdlog/spdlog.h"
 
+/**
+ * The encoding of the DataArrays of a VTK file.
+ */
+enum class VTKFormat {
+    ASCII,      //One value (or vector) per line as text
+    BASE64,     //Binary Float64 data encoded with base64 inside of each DataArray
+    APPENDED    //Raw binary Float64 data appended after the XML structure, referenced by offsets
+};
+
 /**
  * Creates vtk file of the given input.
  * Can be visualized e.g. with ParaView.
+ * The class can also be used as FragmentSink of a streamed Breakup, then every block of fragments becomes one Piece.
+ * In the binary formats every column is written as one contiguous block directly from the arrays of the Satellites SoA.
+ * @note In the streaming mode the appended format is not possible (the offsets of all pieces would have to be known
+ * before the first block), so the blocks are then written inline as base64 instead.
+ *
+ * Optionally the output can be partitioned: Then the points are split into several pieces which are written
+ * concurrently to their own .vtu files, and a .pvtu file referencing them is written. ParaView can load the pieces in
+ * parallel. For a target "result.vtu" the files "result.pvtu", "result_0.vtu", "result_1.vtu", ... are created.
+ * In the streaming mode every block becomes one piece file, so the appended format is possible there as well.
  */
-class VTKWriter : public OutputWriter {
+class VTKWriter : public OutputWriter, public FragmentSink {
+
+    /**
+     * One DataArray of a Piece.
+     */
+    struct Column {
+
+        /**
+         * The name of the property, e.g. mass
+         */
+        std::string name;
+
+        /**
+         * 1 for scalar properties, 3 for vectors
+         */
+        size_t components;
+
+        /**
+         * Returns the contiguous data of the points [begin, begin + count) of the column (count * components values).
+         * Either points directly into an array of the SoA or fills the given buffer and points to it.
+         */
+        using Data = std::function<const double *(size_t begin, size_t count, std::vector<double> &buffer)>;
+
+        Data data;
+
+    };
+
+    /**
+     * The number of DataArrays of a Piece
+     */
+    static constexpr size_t COLUMN_COUNT = 7;
+
+    /**
+     * The name and the number of components of every column in the order in which they are written, the last one is
+     * the position which belongs to the Points
+     */
+    static const std::array<std::pair<const char *, size_t>, COLUMN_COUNT> columnLayout;
+
+    /**
+     * The number of points whose data is requested from a column at once, bounds the buffers of the columns which
+     * are gathered (AoS) or repeated (the shared position of the SoA) and of the encoded base64 text
+     */
+    static constexpr size_t COLUMN_CHUNK_SIZE = 1u << 16u;
+
+    /**
+     * The buffered destination of the file
+     */
+    std::unique_ptr<BufferedTextOutput> _output;
+
+    /**
+     * The encoding of the DataArrays
+     */
+    VTKFormat _format;
+
+    /**
+     * States if the file header was already printed while consuming fragment blocks
+     */
+    bool _headerPrinted{false};
+
+    /**
+     * The target filename without extension, only used by the partitioned output
+     */
+    std::string _filenameStem{};
 
     /**
-     * The logger to write to the file sink
+     * The number of pieces of the partitioned output, 1 means a single .vtu file
      */
-    std::shared_ptr<spdlog::logger> _logger;
+    size_t _pieceCount{1};
+
+    /**
+     * The number of pieces written while consuming fragment blocks in the partitioned output
+     */
+    size_t _consumedPieceCount{0};
 
 public:
 
+    /**
+     * Map containing a mapping from String to VTKFormat.
+     */
+    const static std::map<std::string, VTKFormat> stringToVTKFormat;
+
     VTKWriter() : VTKWriter("breakupResult.vtu") {}
 
     /**
      * Creates a new VTKWriter to a specific file.
      * @param filename - std::string
+     * @param format - the encoding of the DataArrays (default: ASCII)
      */
-    explicit VTKWriter(const std::string &filename)
-            : _logger{spdlog::basic_logger_mt<spdlog::async_factory>("VTKWriter_" + filename, filename, true)} {
-        _logger->set_pattern("%v");
-    }
+    explicit VTKWriter(const std::string &filename, VTKFormat format = VTKFormat::ASCII)
+            : _output{std::make_unique<BufferedTextOutput>(filename)},
+              _format{format} {}
 
     /**
-     * Creates a new VTKWriter with a specific logger which is especially useful if no asynchronous logging properties
-     * are wished (e. g. for testing purposes).
-     * @param logger - a shared_ptr to a logger
+     * Creates a new VTKWriter which partitions the output into several pieces.
+     * @param filename - std::string, the extension is replaced by .pvtu for the index and by _k.vtu for piece k
+     * @param format - the encoding of the DataArrays
+     * @param pieceCount - the number of pieces, 1 creates a single .vtu file like the constructor above
      */
-    explicit VTKWriter(std::shared_ptr<spdlog::logger> logger)
-            : _logger{std::move(logger)} {
-        _logger->set_pattern("%v");
-    }
+    VTKWriter(const std::string &filename, VTKFormat format, size_t pieceCount);
 
     /**
-    * De-Registers the logger of the VTKWriter, to ensure that a similar VTKWriter can be constructed once again.
-    */
-    ~VTKWriter() override{
-        spdlog::drop(_logger->name());
+     * Creates a new VTKWriter with a specific logger which is especially useful for testing purposes.
+     * @param logger - a shared_ptr to a logger
+     * @param format - the encoding of the DataArrays (default: ASCII)
+     * @throws an invalid_argument if the APPENDED format is requested, since a logger cannot write raw bytes
+     */
+    explicit VTKWriter(std::shared_ptr<spdlog::logger> logger, VTKFormat format = VTKFormat::ASCII)
+            : _output{std::make_unique<BufferedTextOutput>(std::move(logger))},
+              _format{format} {
+        if (_format == VTKFormat::APPENDED) {
+            throw std::invalid_argument{"The appended VTK format can only be written to a file!"};
+        }
     }
 
+    ~VTKWriter() override = default;
+
+    using OutputWriter::printResult;
+
     void printResult(const std::vector<Satellite> &satelliteCollection) const override;
 
+    void printResult(const Satellites &satellites) const override;
+
+    void consume(const Satellites &fragments) override;
+
+    void finish() override;
+
 private:
 
     /**
-     * Prints a property of the points.
-     * @tparam Property - the type of the property, if it is an array only size = 3 is supported!!!
-     * @tparam Data - the class which contains this property
-     * @param name - name of the property, e.g. mass
-     * @param property - the property (normally a getter of an satellite)
-     * @param dataCollection - the data
-     */
-    template<typename Property, typename Data>
-    void printProperty(const std::string &name, const std::function<Property(const Data &data)> &property,
-                       const std::vector<Data> &dataCollection) const {
-        if constexpr (std::is_scalar<Property>::value) {
-            _logger->info(R"(        <DataArray Name="{}" NumberOfComponents="1" format="ascii" type="Float32">)",
-                          name);
-            for (const auto &date : dataCollection) {
-                _logger->info("          {}", property(date));
-            }
-            _logger->info(R"(        </DataArray>)");
-        } else if constexpr (util::is_stdarray<Property>::value) {
-            _logger->info(R"(        <DataArray Name="{}" NumberOfComponents="3" format="ascii" type="Float32">)", name);
-            for (const auto &date : dataCollection) {
-                const auto &array = property(date);
-                if (std::size(array) == 3) {
-                    _logger->info("          {} {} {}", array[0], array[1], array[2]);
-                }
-            }
-            _logger->info(R"(        </DataArray>)");
-        } else {
+     * Returns the columns of the satellites.
+     * @param satelliteCollection
+     * @return point data columns followed by the position column
+     */
+    static std::vector<Column> getColumns(const std::vector<Satellite> &satelliteCollection) {
+        return getColumns(satelliteCollection, 0);
+    }
 
+    /**
+     * Returns the columns of the satellites starting at begin.
+     * @param satelliteCollection
+     * @param begin - the first satellite, the points requested from the columns are counted from it
+     * @return point data columns followed by the position column
+     */
+    static std::vector<Column> getColumns(const std::vector<Satellite> &satelliteCollection, size_t begin);
+
+    /**
+     * Returns the columns of the satellites of an SoA.
+     * @param satellites
+     * @return point data columns followed by the position column
+     */
+    static std::vector<Column> getColumns(const Satellites &satellites) {
+        return getColumns(satellites, 0);
+    }
+
+    /**
+     * Returns the columns of the satellites of an SoA starting at begin.
+     * @param satellites
+     * @param begin - the first satellite, the points requested from the columns are counted from it
+     * @return point data columns followed by the position column
+     */
+    static std::vector<Column> getColumns(const Satellites &satellites, size_t begin);
+
+    /**
+     * Combines the data functions with the names and components of the columnLayout.
+     * @param data - the data of every column in the order of the columnLayout
+     * @return the columns
+     */
+    static std::vector<Column> makeColumns(std::array<Column::Data, COLUMN_COUNT> data);
+
+    /**
+     * Splits the points into pieces, writes them concurrently to their piece files and writes the .pvtu index.
+     * @tparam Collection - std::vector<Satellite> or Satellites
+     * @param collection - the satellites
+     * @param size - the number of points
+     */
+    template<typename Collection>
+    void printPartitioned(const Collection &collection, size_t size) const {
+        const size_t pieceCount = std::max<size_t>(1, std::min(_pieceCount, size));
+        auto pieceView = util::indexRange(pieceCount);
+        std::for_each(std::execution::par, pieceView.begin(), pieceView.end(), [&](auto tuple) {
+            auto [piece] = tuple;
+            const size_t begin = size * piece / pieceCount;
+            const size_t end = size * (piece + 1) / pieceCount;
+            this->printPieceFile(piece, end - begin, getColumns(collection, begin), _format);
+        });
+        this->printIndex(pieceCount);
+    }
+
+    /**
+     * Returns the filename of a piece of the partitioned output.
+     * @param piece - the number of the piece
+     * @return filename
+     */
+    [[nodiscard]] std::string getPieceFilename(size_t piece) const;
+
+    /**
+     * Writes one piece of the partitioned output as complete .vtu file.
+     * @param piece - the number of the piece
+     * @param size - the number of points
+     * @param columns - the columns of the points
+     * @param format - the encoding of the DataArrays
+     */
+    void printPieceFile(size_t piece, size_t size, const std::vector<Column> &columns, VTKFormat format) const;
+
+    /**
+     * Writes the .pvtu index of the partitioned output.
+     * @param pieceCount - the number of pieces
+     */
+    void printIndex(size_t pieceCount) const;
+
+    /**
+     * Prints a whole file containing one Piece.
+     * @param size - the number of points
+     * @param columns - the columns of the points
+     */
+    void printFile(size_t size, const std::vector<Column> &columns) const;
+
+    /**
+     * Prints one Piece with the DataArrays inside of the XML structure (ASCII or BASE64).
+     * @param size - the number of points
+     * @param columns - the columns of the points
+     * @param format - ASCII or BASE64
+     */
+    void printPiece(size_t size, const std::vector<Column> &columns, VTKFormat format) const;
+
+    /**
+     * Prints one DataArray inside of the XML structure.
+     * @param size - the number of points
+     * @param column - the column
+     * @param format - ASCII or BASE64
+     * @param buffer - buffer for columns which are not contiguous in memory
+     */
+    void printDataArray(size_t size, const Column &column, VTKFormat format, std::vector<double> &buffer) const;
+
+    /**
+     * Calls the function with the data of consecutive ranges of at most COLUMN_CHUNK_SIZE points of the column.
+     * @tparam Function - callable with the signature void(const double *data, size_t count)
+     * @param size - the number of points
+     * @param column - the column
+     * @param buffer - buffer for columns which are not contiguous in memory
+     * @param function - the function consuming a range
+     */
+    template<typename Function>
+    static void forEachChunk(size_t size, const Column &column, std::vector<double> &buffer, Function function) {
+        for (size_t begin = 0; begin < size; begin += COLUMN_CHUNK_SIZE) {
+            const size_t count = std::min(COLUMN_CHUNK_SIZE, size - begin);
+            function(column.data(begin, count, buffer), count);
         }
     }
 
     /**
      * Prints the Header of the VTK file.
+     */
+    void printHeader() const;
+
+    /**
+     * Prints the Header of a Piece.
      * @param size - the number of points
      */
-    void printHeader(size_t size) const;
+    void printPieceHeader(size_t size) const;
 
     /**
      * Prints the separator between point properties and point position in cell.
      */
     void printSeparator() const;
 
+    /**
+     * Prints the Footer of a Piece.
+     */
+    void printPieceFooter() const;
+
     /**
      * Prints the Footer of the VTK file.
      */
     void printFooter() const;
 
+    /**
+     * Returns the byte order of this machine as VTK attribute value.
+     * @return "LittleEndian" or "BigEndian"
+     */
+    static const char *byteOrder();
 
 };
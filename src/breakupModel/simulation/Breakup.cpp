@@ -5,166 +5,422 @@ void Breakup::run() {
     this->init();
 
     //1. Step: Generate the new Satellites
+    _streaming = false;
+    _windowSize = std::numeric_limits<size_t>::max();
     this->calculateFragmentCount();
+    this->allocateFragments(0, _fragmentCount);
 
-    //2. Step: Assign every new Satellite a value for L_c
-    this->characteristicLengthDistribution();
+    if (_executionMode == ExecutionMode::FUSED) {
+        //2. + 3. + 6. Step: Calculate L_c, A/M, A, M and the ejection velocity in one pass per block of fragments
+        auto blockMass = this->fusedFragmentDistribution();
+        const size_t calculatedCount = _output.size();
 
-    //3. Step: Calculate the A/M (area-to-mass-ratio), A (area) and M (mass) values for every Satellite
-    this->areaToMassRatioDistribution();
+        //4. Step: Enforce the Mass Conservation and remove (or add) fragments
+        this->enforceMassConservation(blockMass);
 
-    //4. Step: Enforce the Mass Conservation and remove (or add) fragments
-    this->enforceMassConservation();
+        //5. Step: Assign parent and by doing that assign each fragment a base velocity
+        this->prepareParentProperties();
+        this->assignParentProperties();
 
-    //5. Step: Assign parent and by doing that assign each fragment a base velocity
-    this->assignParentProperties();
+        //6. Step: Add the ejection velocity (calculate it for fragments added by step 4)
+        this->deltaVelocityDistribution(calculatedCount);
+    } else {
+        //2. Step: Assign every new Satellite a value for L_c
+        this->characteristicLengthDistribution();
+
+        //3. Step: Calculate the A/M (area-to-mass-ratio), A (area) and M (mass) values for every Satellite
+        this->areaToMassRatioDistribution();
+
+        //4. Step: Enforce the Mass Conservation and remove (or add) fragments
+        this->enforceMassConservation(this->calculateBlockMass());
+
+        //5. Step: Assign parent and by doing that assign each fragment a base velocity
+        this->prepareParentProperties();
+        this->assignParentProperties();
+
+        //6. Step: Calculate the Ejection velocity for every Satellite
+        this->deltaVelocityDistribution();
+    }
+
+    //7. Step: As a last step set the _currentMaxGivenID to the new valid value
+    _currentMaxGivenID += _fragmentCount;
+}
+
+void Breakup::runStreaming(const std::vector<std::shared_ptr<FragmentSink>> &sinks, size_t blockSize) {
+    //0. Step: Prepare constants, etc.
+    this->init();
+
+    //1. Step: Determine the number of fragments, they are only allocated window by window
+    _streaming = true;
+    _windowSize = std::max(FRAGMENT_BLOCK_SIZE,
+                           (blockSize + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE * FRAGMENT_BLOCK_SIZE);
+    this->calculateFragmentCount();
+
+    //2. + 3. Step: Calculate only the mass of every block of fragments (first pass)
+    std::vector<double> blockMass{};
+    blockMass.reserve((_fragmentCount + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+    for (size_t begin = 0; begin < _fragmentCount; begin += _windowSize) {
+        auto windowMass = this->generateFragmentRange(begin, std::min(begin + _windowSize, _fragmentCount));
+        blockMass.insert(blockMass.end(), windowMass.begin(), windowMass.end());
+    }
+
+    //4. Step: Enforce the Mass Conservation and determine the final number of fragments
+    this->enforceMassConservation(blockMass);
+    this->prepareParentProperties();
+
+    //Second pass: Regenerate every window with all properties and hand it over to the sinks
+    //While the sinks consume one window, the next one is generated
+    Satellites consumedWindow{};
+    std::future<void> consumer{};
+    for (size_t begin = 0; begin < _fragmentCount; begin += _windowSize) {
+        this->allocateFragments(begin, std::min(_windowSize, _fragmentCount - begin));
+        //2. + 3. + 6. Step: L_c, A/M, A, M and the ejection velocity
+        this->fusedFragmentDistribution();
+        //5. Step: Assign parent and by doing that assign each fragment a base velocity
+        this->assignParentProperties();
+        //6. Step: Add the ejection velocity
+        this->deltaVelocityDistribution(_output.size());
 
-    //6. Step: Calculate the Ejection velocity for every Satellite
-    this->deltaVelocityDistribution();
+        if (consumer.valid()) {
+            consumer.get();
+        }
+        std::swap(_output, consumedWindow);
+        consumer = std::async(std::launch::async, [&sinks, &consumedWindow]() {
+            for (const auto &sink : sinks) {
+                sink->consume(consumedWindow);
+            }
+        });
+    }
+    if (consumer.valid()) {
+        consumer.get();
+    }
+    for (const auto &sink : sinks) {
+        sink->finish();
+    }
 
     //7. Step: As a last step set the _currentMaxGivenID to the new valid value
-    _currentMaxGivenID += _output.size();
+    _currentMaxGivenID += _fragmentCount;
+    _output = Satellites{};
+    _indexOffset = 0;
+    _streaming = false;
+    _windowSize = std::numeric_limits<size_t>::max();
 }
 
 Breakup &Breakup::setSeed(std::optional<unsigned long> seed) {
     if (seed.has_value()) {
-        _fixRNG = std::mt19937 {seed.value()};
+        _fixSeed = std::make_optional<std::uint64_t>(seed.value());
     } else {
-        _fixRNG = std::nullopt;
+        _fixSeed = std::nullopt;
     }
     return *this;
 }
 
+Breakup &Breakup::setExecutionMode(ExecutionMode executionMode) {
+    _executionMode = executionMode;
+    return *this;
+}
+
+Breakup &Breakup::setCurrentMaxGivenID(size_t currentMaxGivenID) {
+    _currentMaxGivenID = currentMaxGivenID;
+    return *this;
+}
+
+Breakup &Breakup::renumberResult(size_t currentMaxGivenID) {
+    _output.startId = currentMaxGivenID + 1;
+    _currentMaxGivenID = currentMaxGivenID + _fragmentCount;
+    return *this;
+}
+
 void Breakup::init() {
     _inputMass = 0;
     _outputMass = 0;
+    if (_fixSeed.has_value()) {
+        _seed = _fixSeed.value();
+    } else {
+        std::random_device randomDevice{};
+        _seed = (static_cast<std::uint64_t>(randomDevice()) << 32u) | randomDevice();
+    }
 }
 
 void Breakup::generateFragments(size_t fragmentCount, const std::array<double, 3> &position) {
-    _output = Satellites{_currentMaxGivenID+1, SatType::DEBRIS, position, fragmentCount};
+    _fragmentCount = fragmentCount;
+    _fragmentPosition = position;
+}
+
+void Breakup::allocateFragments(size_t begin, size_t count) {
+    _indexOffset = begin;
+    _output.startId = _currentMaxGivenID + 1 + begin;
+    _output.satType = SatType::DEBRIS;
+    _output.position = _fragmentPosition;
+    _output.resize(count);
+}
+
+void Breakup::loadFragments(size_t begin, size_t end) {
+    if (begin >= _indexOffset && end <= _indexOffset + _output.size()) {
+        return;
+    }
+    this->generateFragmentRange(begin, end);
+}
+
+std::vector<double> Breakup::generateFragmentRange(size_t begin, size_t end) {
+    if (_streaming) {
+        this->allocateFragments(begin, end - begin);
+    } else {
+        _output.resize(end);
+    }
+    auto blockView = util::indexRange((end - begin + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+    std::vector<double> blockMass(blockView.size());
+    std::transform(std::execution::par, blockView.begin(), blockView.end(), blockMass.begin(),
+                   [&](auto tuple) {
+        auto [block] = tuple;
+        const size_t blockBegin = begin - _indexOffset + block * FRAGMENT_BLOCK_SIZE;
+        return calculateFragmentBlock(blockBegin, std::min(blockBegin + FRAGMENT_BLOCK_SIZE, end - _indexOffset));
+    });
+    return blockMass;
 }
 
 void Breakup::characteristicLengthDistribution() {
-    std::for_each(std::execution::par_unseq, _output.characteristicLength.begin(), _output.characteristicLength.end(),
-                  [&](double &lc) {
-        lc = calculateCharacteristicLength();
+    auto tupleView = _output.getCharacteristicLengthTuple();
+    std::for_each(std::execution::par_unseq, tupleView.begin(), tupleView.end(),
+                  [&](auto tuple) {
+        //Order in the tuple: 0: Index | 1: L_c
+        auto &[index, lc] = tuple;
+        auto rng = getRandomEngine(index, RandomSlot::CHARACTERISTIC_LENGTH);
+        lc = calculateCharacteristicLength(rng);
     });
 }
 
 void Breakup::areaToMassRatioDistribution() {
-    auto tupleView = _output.getAreaMassTuple();
-    std::for_each(std::execution::par_unseq, tupleView.begin(), tupleView.end(),
-                  [&](auto &tuple) {
-        //Order in the tuple: 0: L_c | 1: A/M | 2: Area | 3: Mass
-        auto &[lc, areaToMassRatio, area, mass] = tuple;
+    const size_t size = _output.size();
+    auto blockView = util::indexRange((size + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+    std::for_each(std::execution::par, blockView.begin(), blockView.end(),
+                  [&](auto tuple) {
+        auto [block] = tuple;
+        const size_t begin = block * FRAGMENT_BLOCK_SIZE;
+        const size_t count = std::min(FRAGMENT_BLOCK_SIZE, size - begin);
         //Calculate the A/M value in [m^2/kg]
-        areaToMassRatio = calculateAreaMassRatio(lc);
-        //Calculate the area A in [m^2]
-        area = calculateArea(lc);
-        //Calculate the mass m in [kg]
-        mass = calculateMass(area, areaToMassRatio);
+        calculateAreaMassRatio(begin, count, &_output.characteristicLength[begin], &_output.areaToMassRatio[begin]);
+        for (size_t i = begin; i < begin + count; ++i) {
+            //Calculate the area A in [m^2]
+            _output.area[i] = calculateArea(_output.characteristicLength[i]);
+            //Calculate the mass m in [kg]
+            _output.mass[i] = calculateMass(_output.area[i], _output.areaToMassRatio[i]);
+        }
+    });
+}
+
+std::vector<double> Breakup::fusedFragmentDistribution() {
+    const size_t size = _output.size();
+    auto blockView = util::indexRange((size + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+    std::vector<double> blockMass(blockView.size());
+    std::transform(std::execution::par, blockView.begin(), blockView.end(), blockMass.begin(),
+                   [&](auto tuple) {
+        auto [block] = tuple;
+        const size_t begin = block * FRAGMENT_BLOCK_SIZE;
+        const size_t end = std::min(begin + FRAGMENT_BLOCK_SIZE, size);
+        //L_c, A/M, Area, Mass and the partial mass sum of this block
+        const double mass = calculateFragmentBlock(begin, end);
+        //Ejection Velocity
+        for (size_t i = begin; i < end; ++i) {
+            _output.ejectionVelocity[i] = calculateEjectionVelocity(i, _output.areaToMassRatio[i]);
+        }
+        return mass;
     });
+    return blockMass;
 }
 
-void Breakup::enforceMassConservation() {
-    //Enforce Mass Conservation if the output mass is greater than the input mass
-    _outputMass = std::reduce(std::execution::par_unseq,_output.mass.begin(), _output.mass.end(), 0.0);
+double Breakup::calculateFragmentBlock(size_t begin, size_t end) {
+    //L_c
+    for (size_t i = begin; i < end; ++i) {
+        auto rng = getRandomEngine(i, RandomSlot::CHARACTERISTIC_LENGTH);
+        _output.characteristicLength[i] = calculateCharacteristicLength(rng);
+    }
+    //A/M
+    calculateAreaMassRatio(begin, end - begin, &_output.characteristicLength[begin],
+                           &_output.areaToMassRatio[begin]);
+    //Area, Mass and the partial mass sum of this block
+    double mass = 0.0;
+    for (size_t i = begin; i < end; ++i) {
+        _output.area[i] = calculateArea(_output.characteristicLength[i]);
+        _output.mass[i] = calculateMass(_output.area[i], _output.areaToMassRatio[i]);
+        mass += _output.mass[i];
+    }
+    return mass;
+}
+
+std::vector<double> Breakup::calculateBlockMass() const {
+    const size_t size = _output.size();
+    auto blockView = util::indexRange((size + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+    std::vector<double> blockMass(blockView.size());
+    std::transform(std::execution::par, blockView.begin(), blockView.end(), blockMass.begin(),
+                   [&](auto tuple) {
+        auto [block] = tuple;
+        const size_t begin = block * FRAGMENT_BLOCK_SIZE;
+        const size_t end = std::min(begin + FRAGMENT_BLOCK_SIZE, size);
+        double mass = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+            mass += _output.mass[i];
+        }
+        return mass;
+    });
+    return blockMass;
+}
+
+void Breakup::enforceMassConservation(const std::vector<double> &blockMass) {
+    //The sum over the blocks is sequential, so the result does not depend on the scheduling
+    _outputMass = std::accumulate(blockMass.begin(), blockMass.end(), 0.0);
     spdlog::debug("The simulation got {} kg of input mass", _inputMass);
     spdlog::debug("The simulation produced {} kg of debris", _outputMass);
-    size_t oldSize = _output.size();
-    size_t newSize = _output.size();
-    while (_outputMass > _inputMass) {
-        _outputMass -= _output.mass.back();
-        newSize -= 1;
-        _output.mass.pop_back();
-    }
-    if (oldSize != newSize) {
+    const size_t oldSize = _fragmentCount;
+    size_t newSize = _fragmentCount;
+    if (_outputMass > _inputMass) {
+        //Enforce Mass Conservation if the output mass is greater than the input mass
+        //Keep all fragments up to the first one whose prefix mass sum exceeds the input mass
+        std::tie(newSize, _outputMass) = findMassCut(0, oldSize, blockMass, 0.0, true);
         spdlog::warn("The simulation reduced the number of fragments because the mass budget was exceeded. "
                      "In other words: The random behaviour has produced heavier fragments");
         spdlog::warn("The fragment count was reduced from {} to {} fragments.", oldSize, newSize);
         spdlog::debug("The simulation corrected to {} kg of debris", _outputMass);
-        _output.resize(newSize);
-    } else if (_enforceMassConservation) {
+    } else if (_enforceMassConservation && _outputMass < _inputMass) {
         //This is written in an else if, because if the former condition was true, we already had too many fragments
         //But we only need to check this here when no fragments had to be removed.
-        while (_outputMass < _inputMass) {
-            //Order in the tuple: 0: L_c | 1: A/M | 2: Area | 3: Mass
-            //Create new element and assign values
-            auto tuple = _output.appendElement();
-            auto &[lc, areaToMassRatio, area, mass] = tuple;
-            lc = calculateCharacteristicLength();
-            areaToMassRatio = calculateAreaMassRatio(lc);
-            area = calculateArea(lc);
-            mass = calculateMass(area, areaToMassRatio);
-
-            //Calculate new mass
-            _outputMass += mass;
+        //Additional fragments are generated speculatively in batches, the batch is then cut at the first fragment
+        //which would exceed the mass budget. Since the random numbers are bound to the fragment index, the result
+        //is the same as if the fragments would have been generated one by one.
+        bool budgetReached = false;
+        while (!budgetReached) {
+            const size_t batchBegin = newSize;
+            const size_t batchEnd = newSize + estimateBatchSize(newSize);
+            auto batchBlockMass = generateFragmentRange(batchBegin, batchEnd);
+            //Keep all fragments before the one which leads to reaching the mass budget
+            std::tie(newSize, _outputMass) = findMassCut(batchBegin, batchEnd, batchBlockMass, _outputMass, false);
+            budgetReached = newSize < batchEnd;
         }
-        //Remove the element which has lead to the exceeding of the mass budget
-        _outputMass -= _output.mass.back();
-        _output.popBack();
-        newSize = _output.size();
         spdlog::warn("The simulation increased the number of fragments to enforce the mass conservation.");
         spdlog::warn("The fragment count was increased from {} to {} fragments.", oldSize, newSize);
         spdlog::debug("The simulation corrected to {} kg of debris", _outputMass);
     }
+    _fragmentCount = newSize;
+    if (!_streaming) {
+        _output.resize(newSize);
+    }
 }
 
-void Breakup::deltaVelocityDistribution() {
-    using namespace util;
+std::pair<size_t, double> Breakup::findMassCut(size_t begin, size_t end, const std::vector<double> &blockMass,
+                                               double baseMass, bool allowEqual) {
+    auto exceedsBudget = [this, allowEqual](const double *first, const double *last) {
+        return allowEqual ? std::upper_bound(first, last, _inputMass) : std::lower_bound(first, last, _inputMass);
+    };
+    //Prefix sum over the blocks to find the block containing the cut
+    std::vector<double> blockPrefix(blockMass.size());
+    std::inclusive_scan(blockMass.begin(), blockMass.end(), blockPrefix.begin(), std::plus<>(), baseMass);
+    const size_t block = exceedsBudget(blockPrefix.data(), blockPrefix.data() + blockPrefix.size())
+                         - blockPrefix.data();
+    if (block == blockPrefix.size()) {
+        return std::make_pair(end, blockPrefix.empty() ? baseMass : blockPrefix.back());
+    }
+    //Prefix sum inside this block to find the fragment
+    const size_t blockBegin = begin + block * FRAGMENT_BLOCK_SIZE;
+    const size_t blockEnd = std::min(blockBegin + FRAGMENT_BLOCK_SIZE, end);
+    const double blockBase = block == 0 ? baseMass : blockPrefix[block - 1];
+    this->loadFragments(blockBegin, blockEnd);
+    //The loaded window starts at _indexOffset
+    const auto massBegin = _output.mass.begin() + static_cast<std::ptrdiff_t>(blockBegin - _indexOffset);
+    const auto massEnd = massBegin + static_cast<std::ptrdiff_t>(blockEnd - blockBegin);
+    std::array<double, FRAGMENT_BLOCK_SIZE> prefix{};
+    std::inclusive_scan(massBegin, massEnd, prefix.begin(), std::plus<>(), blockBase);
+    const size_t offset = exceedsBudget(prefix.data(), prefix.data() + (blockEnd - blockBegin)) - prefix.data();
+    return std::make_pair(blockBegin + offset, offset == 0 ? blockBase : prefix[offset - 1]);
+}
+
+size_t Breakup::estimateBatchSize(size_t currentSize) const {
+    if (currentSize == 0 || _outputMass <= 0.0) {
+        return FRAGMENT_BLOCK_SIZE;
+    }
+    //Expected number of fragments to fill the remaining budget with a margin, at most doubling the output per batch
+    //In the streaming mode a batch has to fit into one window
+    const double meanMass = _outputMass / static_cast<double>(currentSize);
+    const auto estimate = static_cast<size_t>(std::ceil(1.25 * (_inputMass - _outputMass) / meanMass));
+    return std::clamp(estimate, FRAGMENT_BLOCK_SIZE, std::min(std::max(FRAGMENT_BLOCK_SIZE, currentSize), _windowSize));
+}
+
+void Breakup::deltaVelocityDistribution(size_t calculatedCount) {
     auto tupleView = _output.getVelocityTuple();
     std::for_each(std::execution::par_unseq, tupleView.begin(), tupleView.end(),
-                  [&](auto &tuple) {
-        //Order in the tuple: 0: A/M | 1: Velocity | 2: Ejection Velocity
-        auto &[areaToMassRatio, velocity, ejectionVelocity] = tuple;
-        //Calculates the velocity as a scalar based on Equation 11/ 12
-        const double chi = log10(areaToMassRatio);
-        const double mu = _deltaVelocityFactorOffset.first * chi + _deltaVelocityFactorOffset.second;
-        constexpr double sigma = 0.4;
-        std::normal_distribution<> normalDistribution{mu, sigma};
-        double velocityScalar = std::pow(10.0, getRandomNumber(normalDistribution));
-
-        //Transform the scalar velocity into a cartesian vector
-        ejectionVelocity = calculateVelocityVector(velocityScalar);
+                  [&](auto tuple) {
+        //Order in the tuple: 0: Index | 1: A/M | 2: Velocity | 3: Ejection Velocity
+        auto &[index, areaToMassRatio, velocity, ejectionVelocity] = tuple;
+        using util::operator+;
+        if (index >= calculatedCount) {
+            ejectionVelocity = calculateEjectionVelocity(index, areaToMassRatio);
+        }
         velocity = velocity + ejectionVelocity;
     });
 }
 
-double Breakup::calculateCharacteristicLength() {
+double Breakup::calculateCharacteristicLength(util::PhiloxEngine &rng) const {
     using util::transformUniformToPowerLaw;
-    static std::uniform_real_distribution<> uniformRealDistribution{0.0, 1.0};
-    const double y = getRandomNumber(uniformRealDistribution);
+    std::uniform_real_distribution<> uniformRealDistribution{0.0, 1.0};
+    const double y = uniformRealDistribution(rng);
     return transformUniformToPowerLaw(_minimalCharacteristicLength, _maximalCharacteristicLength, _lcPowerLawExponent, y);
 }
 
-double Breakup::calculateAreaMassRatio(double characteristicLength) {
+void Breakup::calculateAreaMassRatio(size_t startIndex, size_t count, const double *characteristicLength,
+                                     double *areaToMassRatio) const {
     using namespace util;
-    const double logLc = std::log10(characteristicLength);
+    constexpr double LN_10 = 2.302585092994045684017991454684364208;
+    std::array<double, FRAGMENT_BLOCK_SIZE> logLc{};
+    std::array<double, FRAGMENT_BLOCK_SIZE> z0{};
+    std::array<double, FRAGMENT_BLOCK_SIZE> z1{};
+    std::array<double, FRAGMENT_BLOCK_SIZE> zSoc{};
+    std::array<double, FRAGMENT_BLOCK_SIZE> exponentBig{};
+    std::array<double, FRAGMENT_BLOCK_SIZE> exponentSmall{};
+    std::array<double, FRAGMENT_BLOCK_SIZE> exponent{};
 
-    if (characteristicLength > 0.11) {
-        //Case bigger than 11 cm
-        std::normal_distribution<> n1{mu_1(_satType, logLc), sigma_1(_satType, logLc)};
-        std::normal_distribution<> n2{mu_2(_satType, logLc), sigma_2(_satType, logLc)};
+    for (size_t i = 0; i < count; ++i) {
+        logLc[i] = std::log10(characteristicLength[i]);
+    }
 
-        return std::pow(10.0, alpha(_satType, logLc) * getRandomNumber(n1) +
-            (1 - alpha(_satType, logLc)) * getRandomNumber(n2));
-    } else if (characteristicLength < 0.08) {
-        //Case smaller than 8 cm
-        std::normal_distribution<> n{mu_soc(logLc), sigma_soc(logLc)};
+    //Pre-generate the normal variates, fragments smaller than 8 cm only require one of them
+    //Order of draws: 1. normal of the first mode | 2. normal of the second mode | 3. normal of the small objects case
+    for (size_t i = 0; i < count; ++i) {
+        auto rng = getRandomEngine(startIndex + i, RandomSlot::AREA_MASS_RATIO);
+        std::normal_distribution<> standardNormal{0.0, 1.0};
+        z0[i] = standardNormal(rng);
+        if (characteristicLength[i] < 0.08) {
+            zSoc[i] = z0[i];
+        } else {
+            z1[i] = standardNormal(rng);
+            zSoc[i] = standardNormal(rng);
+        }
+    }
 
-        return std::pow(10.0, getRandomNumber(n));
+    //Evaluate the distribution coefficients, the exponent of the bi-modal case (> 11 cm) and the one of the
+    //small objects case (< 8 cm). Which one applies is selected without branching.
+    if (_satType == SatType::ROCKET_BODY) {
+        areaToMassRatioExponents<SatType::ROCKET_BODY>(count, characteristicLength, logLc.data(), z0.data(),
+                                                       z1.data(), zSoc.data(), exponentBig.data(),
+                                                       exponentSmall.data(), exponent.data());
     } else {
-        //Case between 8 cm and 11 cm
-        std::normal_distribution<> n1{mu_1(_satType, logLc), sigma_1(_satType, logLc)};
-        std::normal_distribution<> n2{mu_2(_satType, logLc), sigma_2(_satType, logLc)};
-        std::normal_distribution<> n{mu_soc(logLc), sigma_soc(logLc)};
+        areaToMassRatioExponents<SatType::SPACECRAFT>(count, characteristicLength, logLc.data(), z0.data(),
+                                                      z1.data(), zSoc.data(), exponentBig.data(),
+                                                      exponentSmall.data(), exponent.data());
+    }
 
-        double y1 = std::pow(10.0, alpha(_satType, logLc) * getRandomNumber(n1) +
-                                 (1.0 - alpha(_satType, logLc)) * getRandomNumber(n2));
-        double y0 = std::pow(10.0, getRandomNumber(n));
+    //10^x for the selected case
+    for (size_t i = 0; i < count; ++i) {
+        areaToMassRatio[i] = std::exp(LN_10 * exponent[i]);
+    }
 
-        //beta * y1 + (1 - beta) * y0 = beta * y1 + y0 - beta * y0 = y0 + beta * (y1 - y0)
-        return y0 + (characteristicLength - 0.08) * (y1 - y0) / (0.03);
+    //Case between 8 cm and 11 cm: Bridging function between the two cases (the small objects value is already set)
+    for (size_t i = 0; i < count; ++i) {
+        const double lc = characteristicLength[i];
+        if (lc >= 0.08 && lc <= 0.11) {
+            const double y1 = std::exp(LN_10 * exponentBig[i]);
+            const double y0 = areaToMassRatio[i];
+            //beta * y1 + (1 - beta) * y0 = beta * y1 + y0 - beta * y0 = y0 + beta * (y1 - y0)
+            areaToMassRatio[i] = y0 + (lc - 0.08) * (y1 - y0) / (0.03);
+        }
     }
 }
 
@@ -184,11 +440,24 @@ double Breakup::calculateMass(double area, double areaMassRatio) {
     return area / areaMassRatio;
 }
 
-std::array<double, 3> Breakup::calculateVelocityVector(double velocity) {
+std::array<double, 3> Breakup::calculateEjectionVelocity(size_t fragmentIndex, double areaToMassRatio) const {
+    auto rng = getRandomEngine(fragmentIndex, RandomSlot::DELTA_VELOCITY);
+    //Calculates the velocity as a scalar based on Equation 11/ 12
+    const double chi = std::log10(areaToMassRatio);
+    const double mu = _deltaVelocityFactorOffset.first * chi + _deltaVelocityFactorOffset.second;
+    constexpr double sigma = 0.4;
+    std::normal_distribution<> normalDistribution{mu, sigma};
+    double velocityScalar = std::pow(10.0, normalDistribution(rng));
+
+    //Transform the scalar velocity into a cartesian vector
+    return calculateVelocityVector(velocityScalar, rng);
+}
+
+std::array<double, 3> Breakup::calculateVelocityVector(double velocity, util::PhiloxEngine &rng) {
     std::uniform_real_distribution<> uniformRealDistribution{0.0, 1.0};
 
-    double u = getRandomNumber(uniformRealDistribution) * 2.0 - 1.0;
-    double theta = getRandomNumber(uniformRealDistribution) * 2.0 * util::PI;
+    double u = uniformRealDistribution(rng) * 2.0 - 1.0;
+    double theta = uniformRealDistribution(rng) * 2.0 * util::PI;
     double v = std::sqrt(1.0 - u * u);
 
     return std::array<double, 3>
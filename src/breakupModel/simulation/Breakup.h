@@ -10,12 +10,17 @@
 #include <memory>
 #include <execution>
 #include <optional>
-#include <mutex>
+#include <cstdint>
+#include <limits>
+#include <future>
 #include "breakupModel/model/Satellite.h"
 #include "breakupModel/model/Satellites.h"
+#include "breakupModel/input/InputConfigurationSource.h"
 #include "breakupModel/util/UtilityContainer.h"
 #include "breakupModel/util/UtilityFunctions.h"
 #include "breakupModel/util/UtilityAreaMassRatio.h"
+#include "breakupModel/util/UtilityRandom.h"
+#include "breakupModel/output/FragmentSink.h"
 #include "spdlog/spdlog.h"
 #include "spdlog/fmt/ostr.h"
 
@@ -88,18 +93,29 @@ protected:
      */
     std::pair<double, double> _deltaVelocityFactorOffset{std::make_pair(0, 0)};
 
+    /**
+     * The number of fragments which are processed together by the batched kernels.
+     * This is also the granularity of the partial mass sums used for the mass conservation.
+     */
+    static constexpr size_t FRAGMENT_BLOCK_SIZE = 256;
+
+    /**
+     * Defines if the simulation steps are executed as separate sweeps or fused per block (default STAGED).
+     */
+    ExecutionMode _executionMode{ExecutionMode::STAGED};
+
     /**
      * This is potential member for testing purpose. It allows the user to fixate a specific seed (with the
-     * method setSeed()). The produced std::mt19937 is then saved in this member and used to calculate random
-     * values. The access on this member must be thread safe!
-     * @note This member is only utilised by getRandomNumber() in case of a fixed seed
+     * method setSeed()). If it has no value, a new seed is drawn from std::random_device at the beginning of every run.
      */
-    std::optional<std::mt19937> _fixRNG{std::nullopt};
+    std::optional<std::uint64_t> _fixSeed{std::nullopt};
 
     /**
-     * This mutex is used if the member _fixRNG has an value, in order to protect parallel access on it.
+     * The seed (key of the counter-based random number generator) of the current run.
+     * Every random number is a pure function of this seed, the fragment index and the slot of the simulation step,
+     * hence the result does not depend on the number of threads or their scheduling.
      */
-    std::mutex _rngMutex;
+    std::uint64_t _seed{0};
 
     /**
      * Contains the input satellites. Normally the fragmentCount for this collection is either one (explosion) or
@@ -109,9 +125,35 @@ protected:
 
     /**
      * Contains the output satellites aka fragments of the collision or explosion
+     * In the streaming mode this only contains a window of the fragments, starting at _indexOffset.
      */
     Satellites _output;
 
+    /**
+     * The number of fragments of this breakup (after the mass conservation the final number)
+     */
+    size_t _fragmentCount{0};
+
+    /**
+     * The position of the fragments, derived from the parents
+     */
+    std::array<double, 3> _fragmentPosition{};
+
+    /**
+     * The index of the fragment stored at _output[0]. This is only not zero in the streaming mode.
+     */
+    size_t _indexOffset{0};
+
+    /**
+     * True if the simulation runs in the streaming mode, then _output is only a window of the fragments.
+     */
+    bool _streaming{false};
+
+    /**
+     * The maximal number of fragments held in _output in the streaming mode (unlimited in the normal mode)
+     */
+    size_t _windowSize{std::numeric_limits<size_t>::max()};
+
 
 public:
 
@@ -141,42 +183,96 @@ public:
      */
     virtual void run();
 
+    /**
+     * Runs the simulation in the streaming mode. The fragments are generated in blocks of blockSize fragments and each
+     * finished block is pushed to the sinks while the next block is generated. Only two blocks are held in memory.
+     * The mass conservation is honoured across all blocks, therefore the fragments are generated twice (first only
+     * their mass, then all properties). The result is identical to run() for the same seed.
+     * Afterwards getResult() and getResultSoA() are empty.
+     * @param sinks - the consumers of the fragment blocks
+     * @param blockSize - the number of fragments per block (rounded up to a multiple of FRAGMENT_BLOCK_SIZE)
+     */
+    void runStreaming(const std::vector<std::shared_ptr<FragmentSink>> &sinks, size_t blockSize);
+
     /**
      * Return the given input for this breakup event.
-     * @return vector of satellites containing the input satellites
+     * @return reference to the vector of satellites containing the input satellites (valid as long as the Breakup)
      */
-    [[nodiscard]] std::vector<Satellite> getInput() const {
+    [[nodiscard]] const std::vector<Satellite> &getInput() const {
         return _input;
     }
 
     /**
      * Return the result of the breakup event.
      * @return vector of satellites containing the generated fragments
+     * @note This converts the whole result into an AoS copy, prefer getResultSoA() where possible
      */
     [[nodiscard]] std::vector<Satellite> getResult() const {
         return _output.getAoS();
     }
 
     /**
-     * Return the result of the breakup event.
-     * @return vector of satellites containing the generated fragments in an SoA
+     * Return the result of the breakup event without copying it.
+     * @return reference to the generated fragments in an SoA (valid until the next run of the Breakup)
      */
-    [[nodiscard]] Satellites getResultSoA() const {
+    [[nodiscard]] const Satellites &getResultSoA() const {
         return _output;
     }
 
     /**
-     * If this method is called with a seed, the Breakup will use only one synchronized generator for random number
-     * generation with this specific seed. This makes whole simulation predictable and therefore very useful for testing.
-     * If no argument is provided or if the std::nullopt is given, the Breakup will be reset to run with multiple
-     * parallel random number generators each initialized with a seed from std::random_device.
+     * Moves the result of the breakup event out of the Breakup. Afterwards the result of the Breakup is empty.
+     * @return the generated fragments in an SoA
+     */
+    [[nodiscard]] Satellites takeResult() {
+        Satellites result{std::move(_output)};
+        _output = Satellites{};
+        return result;
+    }
+
+    /**
+     * If this method is called with a seed, the Breakup will use this seed as key for the counter-based random number
+     * generation. This makes whole simulation predictable (independent of the thread count) and therefore very useful
+     * for testing. If no argument is provided or if the std::nullopt is given, the Breakup will be reset to draw a new
+     * seed from std::random_device at the beginning of every run.
      * @param seed - optional of unsigned long
      * @return this
      */
     Breakup &setSeed(std::optional<unsigned long> seed = std::nullopt);
 
+    /**
+     * Sets the execution mode of the simulation. Both modes produce the same result for the same seed,
+     * FUSED streams the fragment data only once through the memory.
+     * @param executionMode - STAGED or FUSED
+     * @return this
+     */
+    Breakup &setExecutionMode(ExecutionMode executionMode);
+
+    /**
+     * Sets the maximal given ID, the fragments of the next run get IDs greater than this number.
+     * @param currentMaxGivenID - the maximal given (NORAD-Catalog) ID
+     * @return this
+     */
+    Breakup &setCurrentMaxGivenID(size_t currentMaxGivenID);
+
+    /**
+     * Assigns new IDs to the fragments of the last run, afterwards they start directly behind the given ID.
+     * No random number depends on the ID, so the result equals a run with this maximal given ID.
+     * This allows to run several breakups concurrently and to assign their ID ranges afterwards.
+     * @param currentMaxGivenID - the maximal given (NORAD-Catalog) ID
+     * @return this
+     */
+    Breakup &renumberResult(size_t currentMaxGivenID);
+
 protected:
 
+    /**
+     * The simulation steps which require random numbers. Each of them uses its own slot of the counter-based
+     * random number generator, so that the number of draws in one step does not influence another step.
+     */
+    enum class RandomSlot : std::uint32_t {
+        CHARACTERISTIC_LENGTH, AREA_MASS_RATIO, DELTA_VELOCITY
+    };
+
     /**
      * This method does set up the process and correctly inits the required variables.
      * Implementation depends on the subclass.
@@ -190,14 +286,39 @@ protected:
     virtual void calculateFragmentCount() = 0;
 
     /**
-     * Actually creates the fragments (Resizes the vector and assigns a unique ID and name to each fragment)
-     * Further the position vector is correctly set. This one is derived from the parents.
+     * Sets the number of fragments and their position. This one is derived from the parents.
+     * The fragments themselves are allocated by allocateFragments(), all at once in the normal mode or block by block
+     * in the streaming mode.
      * @param fragmentCount - the number of fragments which should be created
-     * @param debrisName - the name for the fragments
      * @param position - position of the fragment, derived from the one parent (explosion) or from first parent (collision)
      */
     virtual void generateFragments(size_t fragmentCount, const std::array<double, 3> &position);
 
+    /**
+     * Resizes the _output to hold the fragments [begin, begin + count) and assigns the IDs and the position.
+     * The capacity of the _output is reused.
+     * @param begin - the index of the first fragment
+     * @param count - the number of fragments
+     */
+    void allocateFragments(size_t begin, size_t count);
+
+    /**
+     * Ensures that the L_c, A/M, area and mass of the fragments [begin, end) are available in the _output.
+     * In the normal mode this is always the case, in the streaming mode the window is regenerated if required.
+     * @param begin - the index of the first fragment
+     * @param end - the index behind the last fragment
+     */
+    void loadFragments(size_t begin, size_t end);
+
+    /**
+     * Generates the L_c, A/M, area and mass of the fragments [begin, end) in parallel blocks. In the normal mode the
+     * _output is extended to end, in the streaming mode the _output becomes the window [begin, end).
+     * @param begin - the index of the first fragment, must be the current fragment count in the normal mode
+     * @param end - the index behind the last fragment
+     * @return the mass sum of each block of FRAGMENT_BLOCK_SIZE fragments starting at begin
+     */
+    std::vector<double> generateFragmentRange(size_t begin, size_t end);
+
     /**
      * Creates the Size Distribution according to an specific powerLaw Exponent.
      * The Exponent comes from the probability density function (pdf) and depends on the subclass.
@@ -211,12 +332,62 @@ protected:
      */
     void areaToMassRatioDistribution();
 
+    /**
+     * Calculates the L_c, A/M, area, mass and the ejection velocity of every fragment in one cache-blocked pass.
+     * The blocks are FRAGMENT_BLOCK_SIZE fragments large and processed in parallel.
+     * @return the mass sum of each block in [kg]
+     */
+    std::vector<double> fusedFragmentDistribution();
+
+    /**
+     * Calculates the L_c, A/M, area and mass of the fragments in the range [begin, end).
+     * @param begin - index of the first fragment
+     * @param end - index behind the last fragment
+     * @return the mass sum of the range in [kg]
+     */
+    double calculateFragmentBlock(size_t begin, size_t end);
+
+    /**
+     * Calculates the mass sum of every block of FRAGMENT_BLOCK_SIZE fragments.
+     * @return the mass sum of each block in [kg]
+     */
+    std::vector<double> calculateBlockMass() const;
+
     /**
      * This method enforces the Mass Conservation.
      * It removes fragments if outputMass > inputMass and
      * it generates more fragments if outputMass < inputMass && _enforceMassConservation is enabled
+     * @param blockMass - the mass sum of each block of FRAGMENT_BLOCK_SIZE fragments
+     */
+    void enforceMassConservation(const std::vector<double> &blockMass);
+
+    /**
+     * Finds the first fragment in [begin, end) at which the prefix mass sum exceeds the input mass.
+     * The search uses the prefix sums of the block masses and then the prefix sums inside the found block.
+     * @param begin - index of the first fragment, the blocks start at this index
+     * @param end - index behind the last fragment
+     * @param blockMass - the mass sum of each block of FRAGMENT_BLOCK_SIZE fragments starting at begin
+     * @param baseMass - the mass of all fragments before begin
+     * @param allowEqual - if true a prefix sum equal to the input mass does not exceed it
+     * @return pair of the index of the found fragment (end if there is none) and the mass of all fragments before it
+     */
+    std::pair<size_t, double> findMassCut(size_t begin, size_t end, const std::vector<double> &blockMass,
+                                          double baseMass, bool allowEqual);
+
+    /**
+     * Estimates how many additional fragments are required to reach the input mass based on the mean mass of the
+     * currently existing fragments.
+     * @param currentSize - the current number of fragments
+     * @return number of fragments to generate in the next batch, at least FRAGMENT_BLOCK_SIZE
+     */
+    size_t estimateBatchSize(size_t currentSize) const;
+
+    /**
+     * Prepares the assignment of the parents after the final fragments are known (e.g. a Collision determines the
+     * fragments which belong to which parent). This is done once for all fragments, also in the streaming mode.
+     * Default implemented: does nothing.
      */
-    void enforceMassConservation();
+    virtual void prepareParentProperties() {}
 
     /**
      * This Method does assign each fragment a parent (trivial in Explosion case) and checks that
@@ -232,26 +403,36 @@ protected:
      * normal distribution. The factor and the offset are both saved,
      * depending on the subclass with different values, in _deltaVelocityFactorOffset
      * The subclasses therefore init _deltaVelocityFactorOffset differently.
+     * @param calculatedCount - number of fragments (from the beginning) whose ejection velocity was already calculated
+     * by the fused pass, for those the ejection velocity is only added to the base velocity
      */
-    void deltaVelocityDistribution();
+    void deltaVelocityDistribution(size_t calculatedCount = 0);
 
 private:
 
     /**
      * This Method calculates one characteristic Length for one Debris Particle.
      * This method uses equation (2) and (4) from the the NASA Breakup Model Paper.
+     * @param rng - the random number generator of the fragment
      * @return L_c in [m]
      */
-    double calculateCharacteristicLength();
+    double calculateCharacteristicLength(util::PhiloxEngine &rng) const;
 
     /**
-     * Calculates an A/M Value for a given L_c.
+     * Calculates the A/M values for a block of consecutive fragments.
      * The utilised equation is chosen based on L_c and the SatType attribute of this Breakup.
      * This method uses equation (5), (6) and (7) from the the NASA Breakup Model Paper.
-     * @param characteristicLength in [m]
-     * @return A/M value in [m^2/kg]
+     * The block is processed in separate loops: The normal variates are drawn into buffers first, so that the loop
+     * evaluating the coefficients (util::areaToMassRatioExponents) is free of branches and is vectorized by the
+     * compiler. The log10 and exponential loops are only vectorized if a vector math library is available
+     * (e.g. glibc's libmvec with -ffast-math), otherwise they remain scalar calls.
+     * @param startIndex - the index of the first fragment of the block (required for the random number generator)
+     * @param count - the number of fragments in the block, at most FRAGMENT_BLOCK_SIZE
+     * @param characteristicLength - pointer to the first L_c in [m] of the block
+     * @param areaToMassRatio - pointer to the first A/M value in [m^2/kg] of the block (output)
      */
-    double calculateAreaMassRatio(double characteristicLength);
+    void calculateAreaMassRatio(size_t startIndex, size_t count, const double *characteristicLength,
+                                double *areaToMassRatio) const;
 
     /**
      * Calculates the Area for one fragment.
@@ -271,31 +452,32 @@ private:
     static double calculateMass(double area, double areaMassRatio);
 
 
+    /**
+     * Calculates the ejection velocity of one fragment according to Equation 11/ 12.
+     * @param fragmentIndex - the index of the fragment (required for the random number generator)
+     * @param areaToMassRatio - the A/M of the fragment in [m^2/kg]
+     * @return 3-dimensional cartesian ejection velocity vector in [m/s]
+     */
+    std::array<double, 3> calculateEjectionVelocity(size_t fragmentIndex, double areaToMassRatio) const;
+
     /**
      * Transforms a scalar velocity into a 3-dimensional cartesian velocity vector.
      * The transformation is based around a uniform Distribution.
      * @param velocity - scalar velocity
+     * @param rng - the random number generator of the fragment
      * @return 3-dimensional cartesian velocity vector
      */
-    std::array<double, 3> calculateVelocityVector(double velocity);
-
-    /**
-     * Returns a random number according to a specific distribution.
-     * @tparam Distribution - should be a Distribution (e. g. a uniform Distribution) which returns doubles
-     * @param distribution
-     * @return a random number
-     * @note This method is thread safe because if different threads call this they will have different random number
-     * generators (for their whole life time)
-     */
-    template<class Distribution>
-    double getRandomNumber(Distribution &distribution) {
-        if (_fixRNG.has_value()) {
-            const std::lock_guard<std::mutex> lock(_rngMutex);
-            return distribution(_fixRNG.value());
-        } else {
-            thread_local std::mt19937 rng{std::random_device{}()};
-            return distribution(rng);
-        }
+    static std::array<double, 3> calculateVelocityVector(double velocity, util::PhiloxEngine &rng);
+
+    /**
+     * Returns the random number generator for one fragment and one simulation step.
+     * @param fragmentIndex - the index of the fragment in the _output (the window in the streaming mode)
+     * @param slot - the simulation step
+     * @return a counter-based random number generator
+     * @note This method is thread safe because the returned generators do not share any state
+     */
+    [[nodiscard]] util::PhiloxEngine getRandomEngine(size_t fragmentIndex, RandomSlot slot) const {
+        return util::PhiloxEngine{_seed, _indexOffset + fragmentIndex, static_cast<std::uint32_t>(slot)};
     }
 
 public:
@@ -311,6 +493,10 @@ public:
     [[nodiscard]] size_t getCurrentMaxGivenId() const {
         return _currentMaxGivenID;
     }
+
+    [[nodiscard]] ExecutionMode getExecutionMode() const {
+        return _executionMode;
+    }
 };
 
 
@@ -7,6 +7,7 @@ BreakupBuilder &BreakupBuilder::reconfigure(const std::shared_ptr<InputConfigura
     this->setCurrentMaximalGivenID(configurationSource->getCurrentMaximalGivenID()),
     this->setIDFilter(configurationSource->getIDFilter());
     this->setEnforceMassConservation(configurationSource->getEnforceMassConservation());
+    this->setExecutionMode(configurationSource->getExecutionMode());
     this->setDataSource(configurationSource->getDataReader());
     return *this;
 }
@@ -41,13 +42,23 @@ BreakupBuilder &BreakupBuilder::setEnforceMassConservation(bool enforceMassConse
     return *this;
 }
 
+BreakupBuilder &BreakupBuilder::setExecutionMode(ExecutionMode executionMode) {
+    _executionMode = executionMode;
+    return *this;
+}
+
 BreakupBuilder &BreakupBuilder::setDataSource(const std::vector<Satellite> &satellites) {
-    _satellites = satellites;
+    _catalog = std::make_shared<const SatelliteCatalog>(satellites);
     return *this;
 }
 
 BreakupBuilder &BreakupBuilder::setDataSource(const std::shared_ptr<const DataSource> &dataSource) {
-    _satellites = dataSource->getSatelliteCollection();
+    _catalog = std::make_shared<const SatelliteCatalog>(dataSource->getSatelliteCollection());
+    return *this;
+}
+
+BreakupBuilder &BreakupBuilder::setDataSource(const std::shared_ptr<const SatelliteCatalog> &catalog) {
+    _catalog = catalog;
     return *this;
 }
 
@@ -101,30 +112,27 @@ std::unique_ptr<Breakup> BreakupBuilder::getBreakup() const {
 }
 
 std::unique_ptr<Breakup> BreakupBuilder::createExplosion(std::vector<Satellite> &satelliteVector, size_t maxID) const {
-    return std::make_unique<Explosion>(satelliteVector, _minimalCharacteristicLength, maxID, _enforceMassConservation);
+    auto explosion = std::make_unique<Explosion>(std::move(satelliteVector), _minimalCharacteristicLength, maxID,
+                                                 _enforceMassConservation);
+    explosion->setExecutionMode(_executionMode);
+    return explosion;
 }
 
 std::unique_ptr<Breakup> BreakupBuilder::createCollision(std::vector<Satellite> &satelliteVector, size_t maxID) const {
-    return std::make_unique<Collision>(satelliteVector, _minimalCharacteristicLength, maxID, _enforceMassConservation);
+    auto collision = std::make_unique<Collision>(std::move(satelliteVector), _minimalCharacteristicLength, maxID,
+                                                 _enforceMassConservation);
+    collision->setExecutionMode(_executionMode);
+    return collision;
 }
 
 std::vector<Satellite> BreakupBuilder::applyFilter() const {
     if (_idFilter.has_value()) {
-        std::vector<Satellite> satellitesFiltered{_satellites};
-        satellitesFiltered.erase(std::remove_if(satellitesFiltered.begin(), satellitesFiltered.end(),
-                                                [&](Satellite &sat) {
-                                                    return _idFilter->count(sat.getId()) == 0;
-                                                }),
-                                 satellitesFiltered.end());
-        return satellitesFiltered;
+        return _catalog->select(*_idFilter);
     } else {
-        return _satellites;
+        return _catalog->getSatellites();
     }
 }
 
 size_t BreakupBuilder::deriveMaximalID() const {
-    return _currentMaximalGivenID.value_or(_satellites.empty() ? 0 :
-                                           std::max_element(_satellites.begin(), _satellites.end(),
-                                                            [](const Satellite &sat1, const Satellite &sat2) {
-                                                                return sat1.getId() < sat2.getId();})->getId());
+    return _currentMaximalGivenID.value_or(_catalog->getMaximalID());
 }
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include "breakupModel/input/InputConfigurationSource.h"
 #include "breakupModel/input/DataSource.h"
+#include "breakupModel/model/SatelliteCatalog.h"
 #include "Breakup.h"
 #include "Explosion.h"
 #include "Collision.h"
@@ -27,10 +28,15 @@ class BreakupBuilder {
 
     std::optional<std::set<size_t>> _idFilter;
 
-    std::vector<Satellite> _satellites;
-
     bool _enforceMassConservation;
 
+    ExecutionMode _executionMode;
+
+    /**
+     * The input satellites with their ID index, shared between copies of this builder
+     */
+    std::shared_ptr<const SatelliteCatalog> _catalog;
+
 public:
 
     explicit BreakupBuilder(const std::shared_ptr<InputConfigurationSource> &configurationSource)
@@ -40,7 +46,26 @@ public:
               _currentMaximalGivenID{configurationSource->getCurrentMaximalGivenID()},
               _idFilter{configurationSource->getIDFilter()},
               _enforceMassConservation{configurationSource->getEnforceMassConservation()},
-              _satellites{configurationSource->getDataReader()->getSatelliteCollection()} {}
+              _executionMode{configurationSource->getExecutionMode()},
+              _catalog{std::make_shared<const SatelliteCatalog>(
+                      configurationSource->getDataReader()->getSatelliteCollection())} {}
+
+    /**
+     * Creates a new BreakupBuilder for an already loaded catalog, the DataSource of the configuration is not used.
+     * This allows several builders (e.g. the events of a scenario) to share one catalog.
+     * @param configurationSource - the configuration
+     * @param catalog - the input satellites
+     */
+    BreakupBuilder(const std::shared_ptr<InputConfigurationSource> &configurationSource,
+                   std::shared_ptr<const SatelliteCatalog> catalog)
+            : _configurationSource{configurationSource},
+              _minimalCharacteristicLength{configurationSource->getMinimalCharacteristicLength()},
+              _simulationType{configurationSource->getTypeOfSimulation()},
+              _currentMaximalGivenID{configurationSource->getCurrentMaximalGivenID()},
+              _idFilter{configurationSource->getIDFilter()},
+              _enforceMassConservation{configurationSource->getEnforceMassConservation()},
+              _executionMode{configurationSource->getExecutionMode()},
+              _catalog{std::move(catalog)} {}
 
     /**
      * Adds an input source for the satellites.
@@ -92,6 +117,13 @@ public:
      */
     BreakupBuilder &setEnforceMassConservation(bool enforceMassConservation);
 
+    /**
+     * Overrides/ Re-Sets the ExecutionMode of the created Breakup Simulation.
+     * @param executionMode - STAGED or FUSED
+     * @return this
+     */
+    BreakupBuilder &setExecutionMode(ExecutionMode executionMode);
+
     /**
      * Overrides/ Re-Sets the Data Source to a specific Satellite vector
      * @param satellites - vector of satellites
@@ -107,6 +139,13 @@ public:
      */
     BreakupBuilder &setDataSource(const std::shared_ptr<const DataSource> &dataSource);
 
+    /**
+     * Overrides/ Re-Sets the Data Source to an already loaded catalog, which can be shared with other builders.
+     * @param catalog - a pointer to an SatelliteCatalog
+     * @return this
+     */
+    BreakupBuilder &setDataSource(const std::shared_ptr<const SatelliteCatalog> &catalog);
+
     /**
      * Creates a new Breakup Simulation with the given input.
      * Can either be a Collision or an Explosion depending on the satellite number in the SatelliteCollection.
@@ -138,6 +177,7 @@ private:
 
     /**
      * Returns an vector containing only the satellites given in the filterSet.
+     * The satellites are looked up in the ID index of the catalog, so only the selected ones are copied.
      * @return a modified satellite vector
      */
     [[nodiscard]] std::vector<Satellite> applyFilter() const;
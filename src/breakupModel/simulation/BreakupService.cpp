@@ -0,0 +1,298 @@
+#include "BreakupService.h"
+
+#include <sstream>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <chrono>
+#include <set>
+#include "breakupModel/output/CSVWriter.h"
+#include "breakupModel/output/BinaryWriter.h"
+#include "spdlog/spdlog.h"
+
+#ifndef _WIN32
+
+#include <cerrno>
+#include <cstring>
+#include <array>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#endif
+
+namespace {
+
+#ifndef _WIN32
+
+    /**
+     * Input stream buffer reading from a file descriptor (e.g. a connected socket).
+     */
+    class FileDescriptorBuffer : public std::streambuf {
+
+        const int _fd;
+
+        std::array<char, 1u << 16u> _buffer{};
+
+    public:
+
+        explicit FileDescriptorBuffer(int fd) : _fd{fd} {}
+
+    protected:
+
+        int_type underflow() override {
+            ssize_t count;
+            do {
+                count = ::read(_fd, _buffer.data(), _buffer.size());
+            } while (count < 0 && errno == EINTR);
+            if (count <= 0) {
+                return traits_type::eof();
+            }
+            this->setg(_buffer.data(), _buffer.data(), _buffer.data() + count);
+            return traits_type::to_int_type(_buffer[0]);
+        }
+
+    };
+
+    /**
+     * Sends the whole text to the file descriptor.
+     */
+    void sendAll(int fd, const std::string &text) {
+#ifdef MSG_NOSIGNAL
+        constexpr int flags = MSG_NOSIGNAL;
+#else
+        constexpr int flags = 0;
+#endif
+        size_t sent = 0;
+        while (sent < text.size()) {
+            const ssize_t count = ::send(fd, text.data() + sent, text.size() - sent, flags);
+            if (count < 0 && errno == EINTR) {
+                continue;
+            } else if (count <= 0) {
+                throw std::runtime_error{"The response could not be sent: " + std::string{std::strerror(errno)}};
+            }
+            sent += static_cast<size_t>(count);
+        }
+    }
+
+#endif
+
+}
+
+std::string BreakupService::handle(const std::string &request, size_t requestNumber) const {
+    //Generated IDs are prefixed, so they cannot collide with the numeric IDs given by requests
+    std::string requestID = '#' + std::to_string(requestNumber);
+    try {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto requestReader = std::make_shared<YAMLRequestReader>(request);
+        if (auto givenID = requestReader->getRequestID(); givenID.has_value()) {
+            requestID = std::to_string(givenID.value());
+        }
+        const ResultFormat format = requestReader->getResultFormat();
+
+        //The request either selects satellites of the catalog or brings its own ones, without an idFilter the whole
+        //catalog would be copied into the breakup
+        const bool hasSatellites = requestReader->hasSatellites();
+        if (!hasSatellites && !requestReader->getIDFilter().has_value()) {
+            throw std::runtime_error{"The request neither selects satellites by an idFilter nor contains satellites!"};
+        }
+        size_t currentMaxGivenID = _currentMaxGivenID;
+        std::shared_ptr<const SatelliteCatalog> satellites{_catalog};
+        if (hasSatellites) {
+            satellites = std::make_shared<const SatelliteCatalog>(
+                    requestReader->getDataReader()->getSatelliteCollection());
+            currentMaxGivenID = std::max(currentMaxGivenID, satellites->getMaximalID());
+        }
+        BreakupBuilder breakupBuilder{requestReader, satellites};
+        breakupBuilder.setCurrentMaximalGivenID(requestReader->getCurrentMaximalGivenID().value_or(currentMaxGivenID));
+        auto breakup = breakupBuilder.getBreakup();
+        breakup->setSeed(requestReader->getSeed());
+        breakup->run();
+
+        const Satellites &result = breakup->getResultSoA();
+        std::ostringstream content{};
+        if (format == ResultFormat::BINARY) {
+            BinaryWriter{content}.printResult(result);
+        } else {
+            CSVWriter{content}.printResult(result);
+        }
+        std::string response = header("RESULT " + requestID
+                                      + (format == ResultFormat::BINARY ? " binary " : " csv ")
+                                      + std::to_string(result.size()), static_cast<size_t>(content.tellp()));
+        response.append(content.str());
+        auto end = std::chrono::high_resolution_clock::now();
+        spdlog::debug("Request {} produced {} fragments in {} ms", requestID, result.size(),
+                      std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+        return response;
+    } catch (std::exception &e) {
+        spdlog::warn("Request {} failed: {}", requestID, e.what());
+        const std::string message{e.what()};
+        return header("ERROR " + requestID, message.size()) + message;
+    }
+}
+
+void BreakupService::serve(std::istream &input, const std::function<void(const std::string &)> &output) const {
+    std::deque<std::pair<size_t, std::string>> requests{};
+    bool endOfInput = false;
+    std::mutex requestsMutex{};
+    std::condition_variable requestsCondition{};
+    //Bounds the requests read ahead of the workers
+    const size_t maximalQueueSize = 2 * _workerCount;
+
+    std::mutex outputMutex{};
+    std::exception_ptr outputError{};
+    std::vector<std::thread> workers{};
+    workers.reserve(_workerCount);
+    for (size_t worker = 0; worker < _workerCount; ++worker) {
+        workers.emplace_back([&]() {
+            while (true) {
+                std::pair<size_t, std::string> request{};
+                {
+                    std::unique_lock<std::mutex> lock{requestsMutex};
+                    requestsCondition.wait(lock, [&]() { return !requests.empty() || endOfInput; });
+                    if (requests.empty()) {
+                        return;
+                    }
+                    request = std::move(requests.front());
+                    requests.pop_front();
+                }
+                requestsCondition.notify_all();
+                const std::string response = this->handle(request.second, request.first);
+                std::lock_guard<std::mutex> lock{outputMutex};
+                if (outputError) {
+                    continue;
+                }
+                try {
+                    output(response);
+                } catch (...) {
+                    outputError = std::current_exception();
+                }
+            }
+        });
+    }
+
+    std::string line{};
+    size_t requestNumber = 0;
+    while (std::getline(input, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        {
+            std::unique_lock<std::mutex> lock{requestsMutex};
+            requestsCondition.wait(lock, [&]() { return requests.size() < maximalQueueSize; });
+            requests.emplace_back(requestNumber++, std::move(line));
+        }
+        requestsCondition.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock{requestsMutex};
+        endOfInput = true;
+    }
+    requestsCondition.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (outputError) {
+        std::rethrow_exception(outputError);
+    }
+}
+
+void BreakupService::listen(const std::string &socketPath) {
+#ifndef _WIN32
+    sockaddr_un address{};
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error{"The socket path " + socketPath + " is too long!"};
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    const int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        throw std::runtime_error{"The socket could not be created: " + std::string{std::strerror(errno)}};
+    }
+    ::unlink(socketPath.c_str());
+    if (::bind(listenFd, reinterpret_cast<const sockaddr *>(&address), sizeof(sockaddr_un)) != 0
+        || ::listen(listenFd, SOMAXCONN) != 0) {
+        const std::string reason{std::strerror(errno)};
+        ::close(listenFd);
+        throw std::runtime_error{"The socket " + socketPath + " could not be bound: " + reason};
+    }
+    spdlog::info("The service listens on {}", socketPath);
+    //A stop before this point finds no socket to shut down, so the flag is checked once the socket is published
+    _listenFd = listenFd;
+
+    //Every connection is served by its own thread, the service waits for all of them before it returns
+    std::set<int> activeConnections{};
+    std::mutex connectionsMutex{};
+    std::condition_variable connectionsCondition{};
+    while (!_stopRequested) {
+        const int connectionFd = ::accept(listenFd, nullptr, nullptr);
+        if (connectionFd < 0 && errno == EINTR) {
+            continue;
+        } else if (connectionFd < 0) {
+            if (!_stopRequested) {
+                spdlog::warn("The service stops accepting connections: {}", std::strerror(errno));
+            }
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock{connectionsMutex};
+            activeConnections.insert(connectionFd);
+        }
+        std::thread{[&, connectionFd]() {
+            try {
+                FileDescriptorBuffer buffer{connectionFd};
+                std::istream input{&buffer};
+                this->serve(input, [connectionFd](const std::string &response) {
+                    sendAll(connectionFd, response);
+                });
+            } catch (std::exception &e) {
+                spdlog::warn("A connection was closed: {}", e.what());
+            }
+            //Notified under the lock, the waiting service may return (and destroy the condition) right afterwards
+            std::lock_guard<std::mutex> lock{connectionsMutex};
+            activeConnections.erase(connectionFd);
+            ::close(connectionFd);
+            connectionsCondition.notify_all();
+        }}.detach();
+    }
+    _listenFd = -1;
+    ::close(listenFd);
+    ::unlink(socketPath.c_str());
+
+    //The open connections end their input, so the requests already read are still answered
+    std::unique_lock<std::mutex> lock{connectionsMutex};
+    if (!activeConnections.empty()) {
+        spdlog::info("The service waits for {} open connections", activeConnections.size());
+    }
+    for (const int connectionFd : activeConnections) {
+        ::shutdown(connectionFd, SHUT_RD);
+    }
+    connectionsCondition.wait(lock, [&]() { return activeConnections.empty(); });
+    spdlog::info("The service stopped listening on {}", socketPath);
+#else
+    throw std::runtime_error{"Unix domain sockets are not available on this platform, the requests can only be "
+                             "read from stdin!"};
+#endif
+}
+
+void BreakupService::stop() {
+    _stopRequested = true;
+#ifndef _WIN32
+    //Linux wakes a blocked accept with an error once the listening socket is shut down
+    const int listenFd = _listenFd;
+    if (listenFd >= 0) {
+        ::shutdown(listenFd, SHUT_RDWR);
+    }
+#endif
+}
+
+std::string BreakupService::header(const std::string &parts, size_t byteCount) {
+    return parts + ' ' + std::to_string(byteCount) + '\n';
+}
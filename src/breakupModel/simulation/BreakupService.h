@@ -0,0 +1,111 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <functional>
+#include <istream>
+#include <thread>
+#include <algorithm>
+#include <atomic>
+#include "BreakupBuilder.h"
+#include "breakupModel/model/SatelliteCatalog.h"
+#include "breakupModel/input/YAMLRequestReader.h"
+
+/**
+ * Long-running service answering breakup requests against a catalog which is loaded only once.
+ * Every request is one line of YAML (see YAMLRequestReader) containing the satellite IDs or the satellites itself and
+ * the configuration in the vocabulary of the BreakupBuilder. The requests of one connection are handled concurrently
+ * by a fixed number of workers, the responses are written in the order in which they are finished.<br>
+ * Every response is a header line followed by exactly the given number of bytes (CSV lines, binary result or message):
+ * <br>RESULT [request ID] [csv|binary] [fragment count] [byte count]
+ * <br>ERROR [request ID] [byte count]<br>
+ * The request ID is the one of the request or, if not given, '#' followed by the number of the request in its
+ * connection (e.g. #0), so that it cannot be confused with a given ID.
+ * @note Requests are independent: every request starts its fragment IDs after the maximal given ID of the request or
+ * of the service, so the results of two requests may share IDs.
+ */
+class BreakupService {
+
+    /**
+     * The catalog shared by all requests
+     */
+    const std::shared_ptr<const SatelliteCatalog> _catalog;
+
+    /**
+     * The maximal given ID for requests without their own
+     */
+    const size_t _currentMaxGivenID;
+
+    /**
+     * The number of requests handled concurrently per connection
+     */
+    const size_t _workerCount;
+
+    /**
+     * The socket on which the service currently listens, -1 if there is none
+     */
+    std::atomic<int> _listenFd{-1};
+
+    /**
+     * Set by stop, listen does not accept further connections
+     */
+    std::atomic<bool> _stopRequested{false};
+
+public:
+
+    /**
+     * Creates a new BreakupService.
+     * @param catalog - the satellites the requests refer to by their ID
+     * @param currentMaxGivenID - the maximal given ID for requests without their own
+     * @param workerCount - the number of requests handled concurrently per connection (Default: number of cores)
+     */
+    BreakupService(std::shared_ptr<const SatelliteCatalog> catalog, size_t currentMaxGivenID,
+                   size_t workerCount = std::max(1u, std::thread::hardware_concurrency()))
+            : _catalog{std::move(catalog)},
+              _currentMaxGivenID{currentMaxGivenID},
+              _workerCount{std::max<size_t>(1, workerCount)} {}
+
+    /**
+     * Simulates one request and returns the complete response. Errors are reported by an ERROR response.
+     * @param request - the request as one line of YAML
+     * @param requestNumber - the number of the request used as ID if the request has none
+     * @return the response (header line and content)
+     */
+    std::string handle(const std::string &request, size_t requestNumber) const;
+
+    /**
+     * Reads the requests line by line until the end of the input and answers them concurrently. Empty lines and lines
+     * starting with '#' are ignored. Returns after every request was answered.
+     * @param input - the requests
+     * @param output - function writing one response, it is never called concurrently
+     * @throws the exception of the output function (after the remaining requests were simulated)
+     */
+    void serve(std::istream &input, const std::function<void(const std::string &response)> &output) const;
+
+    /**
+     * Accepts connections on a Unix domain socket and serves each of them (see serve) until stop is called.
+     * An existing file at the path is replaced. After the stop the open connections are not read any further, the
+     * requests already read are still answered. Returns after every connection was closed and the socket file was
+     * removed.
+     * @param socketPath - the path of the socket
+     * @throws a runtime_error if the socket cannot be created or Unix domain sockets are not available
+     */
+    void listen(const std::string &socketPath);
+
+    /**
+     * Makes listen stop accepting connections and return. It is async-signal-safe, so it can be called by a signal
+     * handler, and has no effect on serve.
+     */
+    void stop();
+
+private:
+
+    /**
+     * Creates the header line of a response.
+     * @param parts - the fields of the header without the byte count
+     * @param byteCount - the length of the content
+     * @return the header line including the line break
+     */
+    static std::string header(const std::string &parts, size_t byteCount);
+
+};
@@ -57,46 +57,133 @@ void Collision::calculateFragmentCount() {
     this->generateFragments(fragmentCount, sat1.getPosition());
 }
 
+void Collision::prepareParentProperties() {
+    //Debris greater than the small parent belong to the big parent
+    //The rest is assigned to the big parent in order until the mass of the big parent is reached
+    //first if: the mass of the bigSat is normed to the actual produced mass of the simulation
+    const double normedMassBigSat = _input.at(0).getMass() * _outputMass / _inputMass;
+    _parentCutIndex = findParentCut(normedMassBigSat);
+}
+
 void Collision::assignParentProperties() {
     //The names of the fragments for a given parent
     const Satellite &bigSat = _input.at(0);
     const Satellite &smallSat = _input.at(1);
-    auto debrisNameBigPtr = std::make_shared<const std::string>(bigSat.getName() + "-Collision-Fragment");
-    auto debrisNameSmallPtr = std::make_shared<const std::string>(smallSat.getName() + "-Collision-Fragment");
-
-    //Assign debris the big parent if they are greater than the small parent
-    double assignedMassForBigSatellite = 0;
-
-    auto tupleView = _output.getCMVNTuple();
-    //Not parallel! We do not want any race conditions on assignedMassForBigSatellite
-    std::for_each(tupleView.begin(), tupleView.end(),
-                  [&](auto &tuple) {
-        //Order in the tuple: 0: Characteristic Length | 1: Mass | 2: Velocity | 3: NamePtr
-        auto &[lc, mass, velocity, name] = tuple;
-        if (lc > smallSat.getCharacteristicLength()) {
-            name = debrisNameBigPtr;
+    _output.nameTable.clear();
+    const std::uint8_t bigSatName = _output.appendName(
+            std::make_shared<const std::string>(bigSat.getName() + "-Collision-Fragment"));
+    const std::uint8_t smallSatName = _output.appendName(
+            std::make_shared<const std::string>(smallSat.getName() + "-Collision-Fragment"));
+
+    auto tupleView = _output.getCMVPTuple();
+    std::for_each(std::execution::par_unseq, tupleView.begin(), tupleView.end(),
+                  [&](auto tuple) {
+        //Order in the tuple: 0: Index | 1: Characteristic Length | 2: Mass | 3: Velocity | 4: Parent
+        auto &[index, lc, mass, velocity, parentIndex] = tuple;
+        if (lc > smallSat.getCharacteristicLength() || _indexOffset + index < _parentCutIndex) {
+            parentIndex = bigSatName;
             velocity = bigSat.getVelocity();
-            assignedMassForBigSatellite += mass;
+        } else {
+            parentIndex = smallSatName;
+            velocity = smallSat.getVelocity();
         }
     });
+}
 
-    //Assign the rest with respect to the already assigned debris-mass for the big satellite
-    //first if: the mass of the bigSat is normed to the actual produced mass of the simulation
-    const double normedMassBigSat = bigSat.getMass() * _outputMass / _inputMass;
-    //Not parallel! We do not want any race conditions on assignedMassForBigSatellite
-    std::for_each(tupleView.begin(), tupleView.end(),
-                  [&](auto &tuple) {
-        //Order in the tuple: 0: Characteristic Length | 1: Mass | 2: Velocity | 3: NamePtr
-        auto &[lc, mass, velocity, name] = tuple;
-        if (lc <= smallSat.getCharacteristicLength()) {
-            if (assignedMassForBigSatellite < normedMassBigSat) {
-                name = debrisNameBigPtr;
-                velocity = bigSat.getVelocity();
-                assignedMassForBigSatellite += mass;
-            } else {
-                name = debrisNameSmallPtr;
-                velocity = smallSat.getVelocity();
+size_t Collision::findParentCut(double normedMassBigSat) {
+    const double smallLc = _input.at(1).getCharacteristicLength();
+    const size_t size = _fragmentCount;
+
+    //Returns L_c and mass of one fragment, in the streaming mode the window containing it is loaded if required
+    auto fragment = [&](size_t index) {
+        if (index < _indexOffset || index >= _indexOffset + _output.size()) {
+            const size_t windowBegin = index - index % FRAGMENT_BLOCK_SIZE;
+            loadFragments(windowBegin, windowBegin + std::min(_windowSize, size - windowBegin));
+        }
+        return std::make_pair(_output.characteristicLength[index - _indexOffset], _output.mass[index - _indexOffset]);
+    };
+
+    //Mass sums of the fragments greater than the small parent (first) and of the remaining ones (second) per block
+    std::vector<std::pair<double, double>> blockMass((size + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+    for (size_t windowBegin = 0; windowBegin < size; windowBegin += std::min(_windowSize, size - windowBegin)) {
+        const size_t windowEnd = windowBegin + std::min(_windowSize, size - windowBegin);
+        loadFragments(windowBegin, windowEnd);
+        auto blockView = util::indexRange((windowEnd - windowBegin + FRAGMENT_BLOCK_SIZE - 1) / FRAGMENT_BLOCK_SIZE);
+        std::transform(std::execution::par, blockView.begin(), blockView.end(),
+                       blockMass.begin() + windowBegin / FRAGMENT_BLOCK_SIZE, [&](auto tuple) {
+            auto [block] = tuple;
+            const size_t begin = windowBegin - _indexOffset + block * FRAGMENT_BLOCK_SIZE;
+            const size_t end = std::min(begin + FRAGMENT_BLOCK_SIZE, windowEnd - _indexOffset);
+            double bigMass = 0.0;
+            double smallMass = 0.0;
+            for (size_t i = begin; i < end; ++i) {
+                if (_output.characteristicLength[i] > smallLc) {
+                    bigMass += _output.mass[i];
+                } else {
+                    smallMass += _output.mass[i];
+                }
             }
+            return std::make_pair(bigMass, smallMass);
+        });
+    }
+
+    //Scan over the blocks: blockBase[b] is the mass assigned to the big parent before block b
+    double assignedMass = std::accumulate(blockMass.begin(), blockMass.end(), 0.0,
+                                          [](double sum, const auto &pair) { return sum + pair.first; });
+    std::vector<double> blockBase(blockMass.size());
+    for (size_t block = 0; block < blockMass.size(); ++block) {
+        blockBase[block] = assignedMass;
+        assignedMass += blockMass[block].second;
+    }
+    const double totalMass = assignedMass;
+
+    //The cut lies in the block before the first block whose base reaches the normed mass, or at its first fragment
+    //Walk from there to the first fragment which is not assigned anymore
+    size_t block = std::lower_bound(blockBase.begin(), blockBase.end(), normedMassBigSat) - blockBase.begin();
+    const bool walkFromStart = block == 0;
+    block = walkFromStart ? 0 : block - 1;
+    size_t cutIndex = size;
+    std::optional<double> previousMass{};
+    assignedMass = block < blockBase.size() ? blockBase[block] : totalMass;
+    for (size_t i = block * FRAGMENT_BLOCK_SIZE; i < size; ++i) {
+        auto [lc, mass] = fragment(i);
+        if (lc <= smallLc) {
+            if (assignedMass >= normedMassBigSat) {
+                cutIndex = i;
+                break;
+            }
+            assignedMass += mass;
+            previousMass = mass;
         }
-    });
+    }
+
+    //The serial assignment sums in a different order. Both results differ at most by the rounding error bound.
+    //If the decisions at the cut are not certain within this bound, the cut is determined by the serial sum.
+    const double roundingBound = 4.0 * static_cast<double>(size + 2) * std::numeric_limits<double>::epsilon()
+                                 * totalMass;
+    const bool cutCertain = cutIndex == size || assignedMass >= normedMassBigSat + roundingBound;
+    const bool previousCertain = previousMass.has_value()
+                                 ? assignedMass - previousMass.value() < normedMassBigSat - roundingBound
+                                 : walkFromStart;
+    if (cutCertain && previousCertain) {
+        return cutIndex;
+    }
+    spdlog::debug("The parent assignment falls back to the serial mass sum");
+    assignedMass = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+        auto [lc, mass] = fragment(i);
+        if (lc > smallLc) {
+            assignedMass += mass;
+        }
+    }
+    for (size_t i = 0; i < size; ++i) {
+        auto [lc, mass] = fragment(i);
+        if (lc <= smallLc) {
+            if (assignedMass >= normedMassBigSat) {
+                return i;
+            }
+            assignedMass += mass;
+        }
+    }
+    return size;
 }
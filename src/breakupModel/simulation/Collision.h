@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include "Breakup.h"
 
 /**
@@ -10,6 +11,11 @@ class Collision : public Breakup {
 
     bool _isCatastrophic;
 
+    /**
+     * The fragments (not greater than the small satellite) with an index smaller than this belong to the big satellite
+     */
+    size_t _parentCutIndex{0};
+
 public:
 
     using Breakup::Breakup;
@@ -20,8 +26,20 @@ private:
 
     void calculateFragmentCount() final;
 
+    void prepareParentProperties() final;
+
     void assignParentProperties() final;
 
+    /**
+     * Finds the first fragment (not greater than the small satellite) which is assigned to the small satellite.
+     * All fragments greater than the small satellite and the other fragments before the returned index belong to the
+     * big satellite. The index is found with prefix sums over blocks of fragments. If the rounding errors of this
+     * summation order could change the result, the serial summation order is used instead.
+     * @param normedMassBigSat - the mass of the big satellite normed to the produced mass
+     * @return index of the cut, the size of the output if all fragments belong to the big satellite
+     */
+    size_t findParentCut(double normedMassBigSat);
+
 public:
 
     bool isIsCatastrophic() const {
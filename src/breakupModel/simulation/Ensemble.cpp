@@ -0,0 +1,51 @@
+#include "Ensemble.h"
+
+Ensemble::Ensemble(BreakupBuilder breakupBuilder, size_t realizationCount, std::optional<std::uint64_t> baseSeed)
+        : _breakupBuilder{std::move(breakupBuilder)},
+          _realizationCount{realizationCount},
+          _baseSeed{0},
+          _currentMaxGivenID{0} {
+    if (baseSeed.has_value()) {
+        _baseSeed = baseSeed.value();
+    } else {
+        std::random_device randomDevice{};
+        _baseSeed = (static_cast<std::uint64_t>(randomDevice()) << 32u) | randomDevice();
+    }
+    //The first Breakup is created directly, so that configuration errors are thrown here
+    auto breakup = _breakupBuilder.getBreakup();
+    _currentMaxGivenID = breakup->getCurrentMaxGivenId();
+    _poolSize = 1;
+    _pool.push_back(std::move(breakup));
+}
+
+void Ensemble::run(const std::function<void(size_t, const Breakup &)> &consumer) {
+    auto realizationView = util::indexRange(_realizationCount);
+    std::for_each(std::execution::par, realizationView.begin(), realizationView.end(),
+                  [&](auto tuple) {
+        auto [realization] = tuple;
+        auto breakup = acquireBreakup();
+        breakup->setCurrentMaxGivenID(_currentMaxGivenID)
+                .setSeed(std::make_optional(getSeed(realization)))
+                .run();
+        consumer(realization, *breakup);
+        releaseBreakup(std::move(breakup));
+    });
+}
+
+std::unique_ptr<Breakup> Ensemble::acquireBreakup() {
+    {
+        std::lock_guard<std::mutex> lock{_poolMutex};
+        if (!_pool.empty()) {
+            auto breakup = std::move(_pool.back());
+            _pool.pop_back();
+            return breakup;
+        }
+        ++_poolSize;
+    }
+    return _breakupBuilder.getBreakup();
+}
+
+void Ensemble::releaseBreakup(std::unique_ptr<Breakup> breakup) {
+    std::lock_guard<std::mutex> lock{_poolMutex};
+    _pool.push_back(std::move(breakup));
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <functional>
+#include <cstdint>
+#include <random>
+#include <execution>
+#include "Breakup.h"
+#include "BreakupBuilder.h"
+#include "breakupModel/util/UtilityZip.h"
+#include "breakupModel/util/UtilityRandom.h"
+
+/**
+ * Runs many realizations of the same breakup event with different seeds (Monte Carlo ensemble).
+ * The realizations are executed concurrently by the parallel algorithms of the standard library, so they share one
+ * thread pool with the parallel steps inside of each Breakup. Every concurrently running realization borrows a
+ * Breakup from a pool, hence the fragment buffers are reused instead of being allocated for every realization.
+ * The seed of a realization is derived from the base seed and the number of the realization, so every realization
+ * is reproducible on its own, independent of the order of execution.
+ * @note All realizations start at the same maximal given ID, since they are alternatives of the same event.
+ */
+class Ensemble {
+
+    /**
+     * Creates the Breakup objects of the pool
+     */
+    BreakupBuilder _breakupBuilder;
+
+    /**
+     * The number of realizations
+     */
+    size_t _realizationCount;
+
+    /**
+     * The seed from which the seeds of the realizations are derived
+     */
+    std::uint64_t _baseSeed;
+
+    /**
+     * The maximal given ID before every realization
+     */
+    size_t _currentMaxGivenID;
+
+    /**
+     * The currently unused Breakup objects
+     */
+    std::vector<std::unique_ptr<Breakup>> _pool{};
+
+    /**
+     * The number of Breakup objects created by this ensemble
+     */
+    size_t _poolSize{0};
+
+    /**
+     * Protects the _pool
+     */
+    std::mutex _poolMutex{};
+
+public:
+
+    /**
+     * Creates a new Ensemble.
+     * @param breakupBuilder - the builder which defines the breakup event
+     * @param realizationCount - the number of realizations
+     * @param baseSeed - the seed of the ensemble, if not given it is drawn from std::random_device
+     * @throws a runtime_error if the builder cannot create a Breakup
+     */
+    Ensemble(BreakupBuilder breakupBuilder, size_t realizationCount,
+             std::optional<std::uint64_t> baseSeed = std::nullopt);
+
+    /**
+     * Runs all realizations. After each realization the consumer is called with the number of the realization and
+     * the Breakup containing its result. The consumer is called concurrently for different realizations, the
+     * Breakup is only valid during the call.
+     * @param consumer - function handling the result of one realization
+     */
+    void run(const std::function<void(size_t realization, const Breakup &breakup)> &consumer);
+
+    /**
+     * Returns the seed which is used for one realization.
+     * @param realization - the number of the realization
+     * @return seed
+     */
+    [[nodiscard]] std::uint64_t getSeed(size_t realization) const {
+        return util::deriveSeed(_baseSeed, realization);
+    }
+
+    [[nodiscard]] std::uint64_t getBaseSeed() const {
+        return _baseSeed;
+    }
+
+    [[nodiscard]] size_t getRealizationCount() const {
+        return _realizationCount;
+    }
+
+    /**
+     * Returns the number of Breakup objects which were created, this is at most the number of concurrently
+     * running realizations.
+     * @return pool size
+     */
+    [[nodiscard]] size_t getPoolSize() const {
+        return _poolSize;
+    }
+
+private:
+
+    /**
+     * Takes a Breakup from the pool or creates a new one if the pool is empty.
+     * @return Breakup
+     */
+    std::unique_ptr<Breakup> acquireBreakup();
+
+    /**
+     * Gives a Breakup back to the pool.
+     * @param breakup - Breakup
+     */
+    void releaseBreakup(std::unique_ptr<Breakup> breakup);
+
+};
@@ -0,0 +1,54 @@
+#include "EnsembleStatistics.h"
+
+EnsembleStatistics::EnsembleStatistics()
+        : _histograms{{Histogram{"Characteristic Length [m]", util::LogBinning{1e-3, 1e2, 50}},
+                       Histogram{"A/M [m^2/kg]", util::LogBinning{1e-3, 1e2, 50}},
+                       Histogram{"Ejection Velocity [m/s]", util::LogBinning{1e0, 1e4, 40}}}} {}
+
+void EnsembleStatistics::add(const Satellites &fragments) {
+    //Number and mass per bin of this realization
+    std::array<std::vector<size_t>, 3> binCount{};
+    std::array<std::vector<double>, 3> binMass{};
+    for (size_t quantity = 0; quantity < _histograms.size(); ++quantity) {
+        binCount[quantity].resize(_histograms[quantity].binning.getBinCount(), 0);
+        binMass[quantity].resize(_histograms[quantity].binning.getBinCount(), 0.0);
+    }
+    double totalMass = 0.0;
+    for (size_t i = 0; i < fragments.size(); ++i) {
+        const std::array<double, 3> values{fragments.characteristicLength[i], fragments.areaToMassRatio[i],
+                                           util::euclideanNorm(fragments.ejectionVelocity[i])};
+        for (size_t quantity = 0; quantity < _histograms.size(); ++quantity) {
+            const size_t bin = _histograms[quantity].binning.binIndex(values[quantity]);
+            binCount[quantity][bin] += 1;
+            binMass[quantity][bin] += fragments.mass[i];
+        }
+        totalMass += fragments.mass[i];
+    }
+
+    //Add the realization to the moments
+    for (size_t quantity = 0; quantity < _histograms.size(); ++quantity) {
+        auto &histogram = _histograms[quantity];
+        for (size_t bin = 0; bin < histogram.count.size(); ++bin) {
+            histogram.count[bin].add(static_cast<double>(binCount[quantity][bin]));
+            histogram.mass[bin].add(binMass[quantity][bin]);
+        }
+    }
+    _fragmentCount.add(static_cast<double>(fragments.size()));
+    _fragmentMass.add(totalMass);
+}
+
+void EnsembleStatistics::merge(const EnsembleStatistics &other) {
+    for (size_t quantity = 0; quantity < _histograms.size(); ++quantity) {
+        auto &histogram = _histograms[quantity];
+        const auto &otherHistogram = other._histograms[quantity];
+        if (histogram.count.size() != otherHistogram.count.size()) {
+            throw std::invalid_argument{"Ensemble statistics with different bins cannot be merged!"};
+        }
+        for (size_t bin = 0; bin < histogram.count.size(); ++bin) {
+            histogram.count[bin].merge(otherHistogram.count[bin]);
+            histogram.mass[bin].merge(otherHistogram.mass[bin]);
+        }
+    }
+    _fragmentCount.merge(other._fragmentCount);
+    _fragmentMass.merge(other._fragmentMass);
+}
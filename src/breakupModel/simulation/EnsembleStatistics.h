@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <exception>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/util/UtilityContainer.h"
+#include "breakupModel/util/UtilityStatistics.h"
+
+/**
+ * Aggregates the results of the realizations of an ensemble into distributions without storing any fragment.
+ * For L_c, A/M and the ejection velocity the fragments of one realization are counted in logarithmic bins (number and
+ * mass of the fragments per bin). Over the realizations mean and variance of these numbers are accumulated per bin,
+ * as well as mean and variance of the total fragment count and mass.
+ * The memory consumption is therefore independent of the number of realizations and the number of fragments.
+ * Two EnsembleStatistics can be merged, e.g. if different threads aggregate different realizations.
+ */
+class EnsembleStatistics {
+
+public:
+
+    /**
+     * The distribution of one fragment property.
+     */
+    struct Histogram {
+
+        /**
+         * The name of the property including its unit
+         */
+        std::string name;
+
+        /**
+         * The bins of the property
+         */
+        util::LogBinning binning;
+
+        /**
+         * Mean and variance (over the realizations) of the number of fragments in each bin
+         */
+        std::vector<util::MomentAccumulator> count;
+
+        /**
+         * Mean and variance (over the realizations) of the mass of the fragments in each bin in [kg]
+         */
+        std::vector<util::MomentAccumulator> mass;
+
+        Histogram(std::string name, const util::LogBinning &binning)
+                : name{std::move(name)},
+                  binning{binning},
+                  count(binning.getBinCount()),
+                  mass(binning.getBinCount()) {}
+
+    };
+
+private:
+
+    /**
+     * The histograms of L_c, A/M and the ejection velocity (in this order)
+     */
+    std::array<Histogram, 3> _histograms;
+
+    /**
+     * Mean and variance of the number of fragments per realization
+     */
+    util::MomentAccumulator _fragmentCount{};
+
+    /**
+     * Mean and variance of the mass of all fragments per realization in [kg]
+     */
+    util::MomentAccumulator _fragmentMass{};
+
+public:
+
+    /**
+     * Creates empty statistics with the default bins:
+     * L_c in [10^-3, 10^2] m, A/M in [10^-3, 10^2] m^2/kg and ejection velocity in [10^0, 10^4] m/s,
+     * each with 10 bins per decade. Fragments outside these ranges are counted in the underflow/ overflow bin.
+     */
+    EnsembleStatistics();
+
+    /**
+     * Adds the result of one realization.
+     * @param fragments - the fragments of the realization
+     */
+    void add(const Satellites &fragments);
+
+    /**
+     * Merges the realizations aggregated by another EnsembleStatistics into this one.
+     * @param other - statistics of other realizations
+     * @throws an invalid_argument if the bins of the statistics are different
+     */
+    void merge(const EnsembleStatistics &other);
+
+    [[nodiscard]] const std::array<Histogram, 3> &getHistograms() const {
+        return _histograms;
+    }
+
+    [[nodiscard]] const util::MomentAccumulator &getFragmentCount() const {
+        return _fragmentCount;
+    }
+
+    [[nodiscard]] const util::MomentAccumulator &getFragmentMass() const {
+        return _fragmentMass;
+    }
+
+    /**
+     * Returns the number of aggregated realizations.
+     * @return number of realizations
+     */
+    [[nodiscard]] size_t getRealizationCount() const {
+        return _fragmentCount.getCount();
+    }
+
+};
@@ -31,14 +31,16 @@ void Explosion::calculateFragmentCount() {
 void Explosion::assignParentProperties() {
     //The name of the fragments
     const Satellite &parent = _input.at(0);
-    auto debrisNamePtr = std::make_shared<const std::string>(parent.getName() + "-Explosion-Fragment");
+    _output.nameTable.clear();
+    const std::uint8_t parentName = _output.appendName(
+            std::make_shared<const std::string>(parent.getName() + "-Explosion-Fragment"));
 
-    auto tupleView = _output.getVNTuple();
+    auto tupleView = _output.getVPTuple();
     std::for_each(std::execution::par, tupleView.begin(), tupleView.end(),
-                  [&](auto &tuple) {
-        //Order in the tuple: 0: Velocity | 1: NamePtr
-        auto &[velocity, name] = tuple;
+                  [&](auto tuple) {
+        //Order in the tuple: 0: Index | 1: Velocity | 2: Parent
+        auto &[index, velocity, parentIndex] = tuple;
         velocity = parent.getVelocity();
-        name = debrisNamePtr;
+        parentIndex = parentName;
     });
 }
@@ -0,0 +1,74 @@
+#include "Scenario.h"
+
+void Scenario::run(const std::function<void(size_t, const Breakup &)> &consumer) {
+    const size_t eventCount = _breakups.size();
+    std::vector<std::exception_ptr> errors(eventCount);
+    std::vector<char> finished(eventCount, false);
+    std::mutex finishedMutex{};
+    std::condition_variable finishedCondition{};
+
+    //The consumer thread takes the events in order, assigns their IDs and hands them to the consumer
+    std::exception_ptr consumerError{};
+    std::thread consumerThread{[&]() {
+        for (size_t event = 0; event < eventCount; ++event) {
+            {
+                std::unique_lock<std::mutex> lock{finishedMutex};
+                finishedCondition.wait(lock, [&]() { return finished[event]; });
+            }
+            if (errors[event] || consumerError) {
+                continue;
+            }
+            try {
+                _breakups[event]->renumberResult(_currentMaxGivenID);
+                _currentMaxGivenID = _breakups[event]->getCurrentMaxGivenId();
+                consumer(event, *_breakups[event]);
+            } catch (...) {
+                consumerError = std::current_exception();
+            }
+            //The fragments of the event are not required anymore
+            static_cast<void>(_breakups[event]->takeResult());
+        }
+    }};
+
+    auto eventRange = util::indexRange(eventCount);
+    try {
+        std::for_each(std::execution::par, eventRange.begin(), eventRange.end(), [&](auto tuple) {
+            auto [event] = tuple;
+            try {
+                _breakups[event]->run();
+            } catch (...) {
+                errors[event] = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock{finishedMutex};
+                finished[event] = true;
+            }
+            finishedCondition.notify_all();
+        });
+    } catch (...) {
+        //The parallel algorithm itself failed (e.g. std::bad_alloc), the remaining events are never finished
+        //Close them, so that the consumer thread does not wait forever
+        {
+            std::lock_guard<std::mutex> lock{finishedMutex};
+            for (size_t event = 0; event < eventCount; ++event) {
+                if (!finished[event]) {
+                    errors[event] = std::current_exception();
+                    finished[event] = true;
+                }
+            }
+        }
+        finishedCondition.notify_all();
+        consumerThread.join();
+        throw;
+    }
+    consumerThread.join();
+
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    if (consumerError) {
+        std::rethrow_exception(consumerError);
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <execution>
+#include "Breakup.h"
+#include "breakupModel/util/UtilityZip.h"
+
+/**
+ * Runs several (different) breakup events as a pipeline, e.g. the reconstruction of historical events.
+ * The events are simulated concurrently by the parallel algorithms of the standard library. A separate thread hands
+ * the finished events to a consumer in the order of the events, so the output of one event is written while the
+ * following events are still simulated.
+ * The fragment IDs of the events do not overlap: Since they are only known after an event is finished, the fragments
+ * are renumbered before they are handed to the consumer, every event continues the IDs of the previous one.
+ */
+class Scenario {
+
+    /**
+     * The breakup events
+     */
+    std::vector<std::unique_ptr<Breakup>> _breakups;
+
+    /**
+     * The maximal given ID, after a run the last ID assigned to a fragment
+     */
+    size_t _currentMaxGivenID;
+
+public:
+
+    /**
+     * Creates a new Scenario.
+     * @param breakups - the events (Explosion or Collision), their own maximal given ID is ignored
+     * @param currentMaxGivenID - the maximal given ID before the first event
+     */
+    Scenario(std::vector<std::unique_ptr<Breakup>> breakups, size_t currentMaxGivenID)
+            : _breakups{std::move(breakups)},
+              _currentMaxGivenID{currentMaxGivenID} {}
+
+    /**
+     * Runs all events. After each event the consumer is called with the number of the event and the Breakup
+     * containing its result. The consumer is called in the order of the events from one thread. Afterwards the
+     * fragments of the event are released.
+     * If an event throws an exception, the other events are still simulated and handed to the consumer, afterwards
+     * the first exception is rethrown.
+     * @param consumer - function handling the result of one event
+     * @throws the first exception of an event, else the one of the consumer or of the parallel algorithm (after the
+     * consumer thread has finished)
+     */
+    void run(const std::function<void(size_t event, const Breakup &breakup)> &consumer);
+
+    [[nodiscard]] size_t getEventCount() const {
+        return _breakups.size();
+    }
+
+    [[nodiscard]] size_t getCurrentMaxGivenID() const {
+        return _currentMaxGivenID;
+    }
+
+};
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <limits>
+#include <cstddef>
 #include "breakupModel/model/Satellite.h"
 
 namespace util {
 
     /**
      * General Template for the if, else if, else statement used by equations 5, 6, 7.
+     * The statement is evaluated branch-free: all three values are computed and blended with 0/1 weights. A plain
+     * select would let the compiler move midReturn into a branch, which it cannot if-convert (the arithmetic may trap),
+     * so loops over many L_c values would not be vectorized. For finite values the result is exactly the selected one.
      * @tparam Function a function taking a single argument
      * @param logLc - log_10(L_c)
      * @param lowerBound - the lowerBound of the interval
@@ -18,13 +23,9 @@ namespace util {
     template<typename Function>
     inline double distributionConstant(double logLc, double lowerBound, double upperBound,
                                        double lowerReturn, double upperReturn, Function midReturn) {
-        if (logLc <= lowerBound) {
-            return lowerReturn;
-        } else if (logLc >= upperBound) {
-            return upperReturn;
-        } else {
-            return midReturn(logLc);
-        }
+        const double isLower = logLc <= lowerBound ? 1.0 : 0.0;
+        const double isUpper = logLc >= upperBound ? 1.0 : 0.0;
+        return (1.0 - isLower - isUpper) * midReturn(logLc) + isLower * lowerReturn + isUpper * upperReturn;
     }
 
     /**
@@ -104,7 +105,37 @@ namespace util {
     * @return sigma as double
     */
     inline double sigma_soc(double logLc) {
-        return logLc <= -3.5 ? 0.2 : 0.2 + 0.1333 * (logLc + 3.5);
+        return distributionConstant(logLc, -3.5, std::numeric_limits<double>::infinity(), 0.2, 0.0,
+                                    [](double logLc) { return 0.2 + 0.1333 * (logLc + 3.5); });
+    }
+
+    /**
+     * Evaluates the exponents of the A/M distribution (equations 5, 6 and 7) for a block of fragments.
+     * The SatType is a template parameter, so that the loop only consists of arithmetic and selects and can be
+     * vectorized by the compiler. Both exponents are stored, so that neither computation is moved into a branch.
+     * @tparam satType - ROCKET_BODY or any other SatType (which is treated as SPACECRAFT)
+     * @param count - the number of fragments
+     * @param characteristicLength - the L_c values in [m]
+     * @param logLc - the log_10(L_c) values
+     * @param z0 - standard normal variates for the first mode (> 11 cm) or the small objects case (< 8 cm)
+     * @param z1 - standard normal variates for the second mode (> 11 cm)
+     * @param zSoc - standard normal variates for the small objects case (< 8 cm)
+     * @param exponentBig - output: the exponent of the bi-modal case (> 11 cm)
+     * @param exponentSmall - output: the exponent of the small objects case (< 8 cm)
+     * @param exponent - output: the exponent of the case selected by L_c (bi-modal for L_c > 11 cm)
+     */
+    template<SatType satType>
+    inline void areaToMassRatioExponents(size_t count, const double *characteristicLength, const double *logLc,
+                                         const double *z0, const double *z1, const double *zSoc,
+                                         double *exponentBig, double *exponentSmall, double *exponent) {
+        for (size_t i = 0; i < count; ++i) {
+            const double a = alpha(satType, logLc[i]);
+            const double n1 = z0[i] * sigma_1(satType, logLc[i]) + mu_1(satType, logLc[i]);
+            const double n2 = z1[i] * sigma_2(satType, logLc[i]) + mu_2(satType, logLc[i]);
+            exponentBig[i] = a * n1 + (1.0 - a) * n2;
+            exponentSmall[i] = zSoc[i] * sigma_soc(logLc[i]) + mu_soc(logLc[i]);
+            exponent[i] = characteristicLength[i] > 0.11 ? exponentBig[i] : exponentSmall[i];
+        }
     }
 
 
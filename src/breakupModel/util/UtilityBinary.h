@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Layout of the columnar binary result format (*.bin).
+ * A file consists of a FileHeader, a table of ColumnEntry, the name table (each name as 64 bit length followed by the
+ * characters) and finally the columns. Every column is one contiguous typed array starting at an ALIGNMENT aligned
+ * offset, so a memory mapped file can be used directly without copying the data.
+ * The shared properties of a Satellites SoA (startId, satType, position) are stored once in the header.
+ * The numbers are stored in the byte order of the writing machine, which is recorded in the header.
+ */
+namespace util::binary {
+
+    /**
+     * The first bytes of every file
+     */
+    constexpr std::array<char, 8> MAGIC{{'B', 'R', 'E', 'A', 'K', 'U', 'P', '\0'}};
+
+    /**
+     * The version of the layout
+     */
+    constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * Written in the byte order of the machine, a reader with a different byte order sees 0x04030201
+     */
+    constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    /**
+     * The alignment of the column arrays in bytes (a cache line)
+     */
+    constexpr std::size_t ALIGNMENT = 64;
+
+    /**
+     * The element type of a column.
+     */
+    enum class ColumnType : std::uint32_t {
+        FLOAT64 = 0, UINT8 = 1
+    };
+
+    /**
+     * The header at the beginning of a file.
+     */
+    struct FileHeader {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrderMark;
+        std::uint64_t size;
+        std::uint64_t startId;
+        std::array<double, 3> position;
+        std::uint32_t satType;
+        std::uint32_t nameCount;
+        std::uint64_t columnCount;
+        std::uint64_t columnTableOffset;
+        std::uint64_t nameTableOffset;
+    };
+
+    /**
+     * The description of one column in the column table.
+     */
+    struct ColumnEntry {
+        std::array<char, 32> name;
+        ColumnType type;
+        std::uint32_t components;
+        std::uint64_t offset;
+        std::uint64_t byteSize;
+    };
+
+    static_assert(sizeof(FileHeader) == 88, "The FileHeader must not contain padding");
+    static_assert(sizeof(ColumnEntry) == 56, "The ColumnEntry must not contain padding");
+
+    /**
+     * Rounds an offset up to the next multiple of ALIGNMENT.
+     * @param offset - in bytes
+     * @return aligned offset
+     */
+    constexpr std::size_t align(std::size_t offset) {
+        return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+}
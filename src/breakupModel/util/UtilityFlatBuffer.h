@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace util::flatbuffer {
+
+    /**
+     * Minimal builder for FlatBuffers (https://google.github.io/flatbuffers/) as far as they are required to write
+     * the metadata of small file formats by hand, e.g. the Apache Arrow IPC format. Tables, strings, vectors of structs
+     * and vectors of tables are supported.
+     * In contrast to the official builder the objects are first collected and then serialized front to back: every
+     * table is followed by the objects it references, so all offsets point forward like the format requires.
+     * Every object must only be referenced once.
+     * @note The builder lives in its own namespace, so the container operators of util are not found by ADL for its
+     * members.
+     */
+    class Builder {
+
+    public:
+
+        /**
+         * Handle of an object added to the builder
+         */
+        using Offset = size_t;
+
+        /**
+         * A table under construction, the fields are identified by their id in the schema (the order of declaration).
+         * Union fields occupy two ids: the type (uint8) and the value (an offset to a table).
+         */
+        class Table {
+
+            friend Builder;
+
+            struct Slot {
+                size_t size{};
+                std::array<std::uint8_t, 8> bytes{};
+                std::optional<Offset> target{};
+            };
+
+            std::vector<std::optional<Slot>> _slots;
+
+            Slot &slot(size_t id) {
+                if (_slots.size() <= id) {
+                    _slots.resize(id + 1);
+                }
+                _slots[id] = Slot{};
+                return *_slots[id];
+            }
+
+        public:
+
+            /**
+             * Sets a scalar field (integer, bool, floating point or enum).
+             * @tparam T - the type of the field in the schema
+             * @param id - the id of the field
+             * @param value - the value
+             * @return this table
+             */
+            template<typename T>
+            Table &scalar(size_t id, T value) {
+                static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Only scalars can be stored inline");
+                Slot &s = slot(id);
+                s.size = sizeof(T);
+                std::memcpy(s.bytes.data(), &value, sizeof(T));
+                return *this;
+            }
+
+            /**
+             * Sets a field referencing another object (table, string or vector).
+             * @param id - the id of the field
+             * @param target - the object
+             * @return this table
+             */
+            Table &offset(size_t id, Offset target) {
+                Slot &s = slot(id);
+                s.size = sizeof(std::uint32_t);
+                s.target = target;
+                return *this;
+            }
+
+        };
+
+    private:
+
+        struct Bytes {
+            std::vector<std::uint8_t> data;
+            size_t count;
+            size_t alignment;
+            bool terminated;
+        };
+
+        using OffsetVector = std::vector<Offset>;
+
+        std::vector<std::variant<Table, Bytes, OffsetVector>> _objects;
+
+        std::vector<std::uint8_t> _buffer;
+
+    public:
+
+        /**
+         * Adds a table.
+         * @param table
+         * @return handle
+         */
+        Offset addTable(Table table) {
+            _objects.emplace_back(std::move(table));
+            return _objects.size() - 1;
+        }
+
+        /**
+         * Adds a string.
+         * @param string
+         * @return handle
+         */
+        Offset addString(std::string_view string) {
+            _objects.emplace_back(Bytes{{string.begin(), string.end()}, string.size(), 4, true});
+            return _objects.size() - 1;
+        }
+
+        /**
+         * Adds a vector of structs, the struct must have the exact memory layout of the schema.
+         * @tparam Struct - trivially copyable type
+         * @param structs
+         * @return handle
+         */
+        template<typename Struct>
+        Offset addStructVector(const std::vector<Struct> &structs) {
+            static_assert(std::is_trivially_copyable_v<Struct>, "Structs are copied bytewise");
+            std::vector<std::uint8_t> data(structs.size() * sizeof(Struct));
+            if (!structs.empty()) {
+                std::memcpy(data.data(), structs.data(), data.size());
+            }
+            _objects.emplace_back(Bytes{std::move(data), structs.size(), std::max<size_t>(4, alignof(Struct)), false});
+            return _objects.size() - 1;
+        }
+
+        /**
+         * Adds a vector of tables (or strings).
+         * @param offsets - handles of the elements
+         * @return handle
+         */
+        Offset addVector(std::vector<Offset> offsets) {
+            _objects.emplace_back(std::move(offsets));
+            return _objects.size() - 1;
+        }
+
+        /**
+         * Serializes the buffer with the given root table.
+         * @param root - handle of the root table
+         * @param alignment - the size of the result is padded to a multiple of it
+         * @return the bytes of the FlatBuffer
+         */
+        std::vector<std::uint8_t> finish(Offset root, size_t alignment = 8) {
+            _buffer.assign(sizeof(std::uint32_t), 0);
+            place(root, 0);
+            _buffer.resize((_buffer.size() + alignment - 1) / alignment * alignment, 0);
+            return std::move(_buffer);
+        }
+
+    private:
+
+        template<typename T>
+        void write(size_t position, T value) {
+            std::memcpy(_buffer.data() + position, &value, sizeof(T));
+        }
+
+        size_t allocate(size_t size, size_t alignment, size_t headerSize = 0) {
+            size_t position = _buffer.size();
+            while (position % 4 != 0 || (position + headerSize) % alignment != 0) {
+                ++position;
+            }
+            _buffer.resize(position + size, 0);
+            return position;
+        }
+
+        /**
+         * Serializes an object at the end of the buffer and lets the offset at referrer point to it.
+         */
+        void place(Offset object, size_t referrer) {
+            const size_t position = std::visit([this](const auto &value) { return serialize(value); },
+                                               _objects[object]);
+            write(referrer, static_cast<std::uint32_t>(position - referrer));
+        }
+
+        size_t serialize(const Bytes &bytes) {
+            const size_t position = allocate(4 + bytes.data.size() + (bytes.terminated ? 1 : 0), bytes.alignment, 4);
+            write(position, static_cast<std::uint32_t>(bytes.count));
+            std::copy(bytes.data.begin(), bytes.data.end(), _buffer.begin() + static_cast<long>(position + 4));
+            return position;
+        }
+
+        size_t serialize(const OffsetVector &offsets) {
+            const size_t position = allocate(4 + 4 * offsets.size(), 4);
+            write(position, static_cast<std::uint32_t>(offsets.size()));
+            for (size_t i = 0; i < offsets.size(); ++i) {
+                place(offsets[i], position + 4 + 4 * i);
+            }
+            return position;
+        }
+
+        size_t serialize(const Table &table) {
+            //Layout of the inline fields: soffset to the vtable, then the fields ordered by decreasing size
+            std::vector<size_t> order{};
+            for (size_t id = 0; id < table._slots.size(); ++id) {
+                if (table._slots[id].has_value()) {
+                    order.push_back(id);
+                }
+            }
+            std::stable_sort(order.begin(), order.end(), [&table](size_t lhs, size_t rhs) {
+                return table._slots[lhs]->size > table._slots[rhs]->size;
+            });
+            std::vector<std::uint16_t> fieldOffsets(table._slots.size(), 0);
+            size_t inlineSize = sizeof(std::int32_t);
+            for (size_t id : order) {
+                const size_t size = table._slots[id]->size;
+                inlineSize = (inlineSize + size - 1) / size * size;
+                fieldOffsets[id] = static_cast<std::uint16_t>(inlineSize);
+                inlineSize += size;
+            }
+
+            const size_t vtableSize = 2 * (2 + fieldOffsets.size());
+            const size_t vtable = allocate(vtableSize, 2);
+            write(vtable, static_cast<std::uint16_t>(vtableSize));
+            write(vtable + 2, static_cast<std::uint16_t>(inlineSize));
+            for (size_t id = 0; id < fieldOffsets.size(); ++id) {
+                write(vtable + 4 + 2 * id, fieldOffsets[id]);
+            }
+
+            const size_t position = allocate(inlineSize, 8);
+            write(position, static_cast<std::int32_t>(position - vtable));
+            for (size_t id : order) {
+                const auto &slot = *table._slots[id];
+                std::copy(slot.bytes.begin(), slot.bytes.begin() + static_cast<long>(slot.size),
+                          _buffer.begin() + static_cast<long>(position + fieldOffsets[id]));
+            }
+            for (size_t id : order) {
+                if (table._slots[id]->target.has_value()) {
+                    place(*table._slots[id]->target, position + fieldOffsets[id]);
+                }
+            }
+            return position;
+        }
+
+    };
+
+}
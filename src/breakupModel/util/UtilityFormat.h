@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <charconv>
+#include <type_traits>
+
+namespace util {
+
+    /**
+     * Appends the shortest representation of a number which reads back to exactly the same value.
+     * In contrast to a std::stringstream this neither allocates nor depends on the locale.
+     * @tparam Number - an arithmetic type
+     * @param out - the string to append to
+     * @param value - the number
+     */
+    template<typename Number, typename = std::enable_if_t<std::is_arithmetic_v<Number>>>
+    inline void appendNumber(std::string &out, Number value) {
+        //Enough for the shortest round-trip representation of a double including sign and exponent
+        std::array<char, 32> buffer{};
+        auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        out.append(buffer.data(), result.ptr);
+    }
+
+    /**
+     * Appends an array of numbers in the form "[x y z]" (the same form as the operator<< for std::array).
+     * @tparam Number - an arithmetic type
+     * @tparam N - the size of the array
+     * @param out - the string to append to
+     * @param array - the numbers
+     */
+    template<typename Number, size_t N>
+    inline void appendArray(std::string &out, const std::array<Number, N> &array) {
+        out.push_back('[');
+        for (size_t i = 0; i < N; ++i) {
+            if (i != 0) {
+                out.push_back(' ');
+            }
+            appendNumber(out, array[i]);
+        }
+        out.push_back(']');
+    }
+
+    /**
+     * Encodes a stream of bytes in base64 (RFC 4648). The bytes can be given in several parts, e.g. a header followed
+     * by the data, and are encoded as if they were contiguous.
+     */
+    class Base64Encoder {
+
+        static constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        /**
+         * The string to append the encoded characters to
+         */
+        std::string &_out;
+
+        /**
+         * Bytes which do not yet form a complete group of three
+         */
+        std::array<unsigned char, 3> _pending{};
+
+        size_t _pendingCount{0};
+
+    public:
+
+        explicit Base64Encoder(std::string &out)
+                : _out{out} {}
+
+        /**
+         * Encodes the next bytes of the stream.
+         * @param data - pointer to the bytes
+         * @param size - the number of bytes
+         */
+        void append(const void *data, size_t size) {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            _out.reserve(_out.size() + (size + 2) / 3 * 4);
+            for (size_t i = 0; i < size; ++i) {
+                _pending[_pendingCount++] = bytes[i];
+                if (_pendingCount == 3) {
+                    encodePending();
+                }
+            }
+        }
+
+        /**
+         * Encodes the remaining bytes with padding. Must be called once at the end of the stream.
+         */
+        void finish() {
+            if (_pendingCount == 0) {
+                return;
+            }
+            const size_t count = _pendingCount;
+            for (size_t i = count; i < 3; ++i) {
+                _pending[i] = 0;
+            }
+            encodePending();
+            _out.replace(_out.size() - (3 - count), 3 - count, 3 - count, '=');
+        }
+
+    private:
+
+        void encodePending() {
+            const unsigned int group = (static_cast<unsigned int>(_pending[0]) << 16u)
+                                       | (static_cast<unsigned int>(_pending[1]) << 8u) | _pending[2];
+            _out.push_back(ALPHABET[(group >> 18u) & 0x3Fu]);
+            _out.push_back(ALPHABET[(group >> 12u) & 0x3Fu]);
+            _out.push_back(ALPHABET[(group >> 6u) & 0x3Fu]);
+            _out.push_back(ALPHABET[group & 0x3Fu]);
+            _pendingCount = 0;
+        }
+
+    };
+
+}
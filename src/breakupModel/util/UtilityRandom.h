@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace util {
+
+    /**
+     * Counter-based random number engine implementing Philox4x32-10.
+     * In contrast to a std::mt19937 this engine has no sequential state which must be shared between threads.
+     * Every draw is a pure function of a key (the seed) and a counter. The counter is composed of a stream number
+     * (e.g. the index of a fragment), a slot (e.g. the step of the simulation) and the number of the draw inside this
+     * stream. Hence the produced numbers do not depend on the thread count or the scheduling.
+     * The class fulfills the requirements of a UniformRandomBitGenerator, so it can be given to any std distribution.
+     * @related Salmon, John K., et al. "Parallel random numbers: as easy as 1, 2, 3." Proceedings of 2011
+     * International Conference for High Performance Computing, Networking, Storage and Analysis. 2011.
+     */
+    class PhiloxEngine {
+
+    public:
+
+        using result_type = std::uint32_t;
+
+    private:
+
+        static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53;
+        static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+        static constexpr std::uint32_t WEYL_0 = 0x9E3779B9;
+        static constexpr std::uint32_t WEYL_1 = 0xBB67AE85;
+        static constexpr unsigned ROUNDS = 10;
+
+        /**
+         * The key derived from the 64 bit seed
+         */
+        std::array<std::uint32_t, 2> _key;
+
+        /**
+         * The counter: 0: draw block | 1: slot | 2: lower stream bits | 3: upper stream bits
+         */
+        std::array<std::uint32_t, 4> _counter;
+
+        /**
+         * The four random numbers produced by the last evaluated block
+         */
+        std::array<std::uint32_t, 4> _buffer{};
+
+        /**
+         * Index of the next unused number in _buffer (4 means the buffer is exhausted)
+         */
+        unsigned _bufferIndex{4};
+
+    public:
+
+        /**
+         * Creates a new engine for a specific seed, stream and slot.
+         * @param seed - the key of the engine
+         * @param stream - the stream number, e.g. the index of a fragment
+         * @param slot - the slot inside a stream, e.g. the step of the simulation which requires random numbers
+         */
+        explicit PhiloxEngine(std::uint64_t seed, std::uint64_t stream = 0, std::uint32_t slot = 0)
+                : _key{{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32u)}},
+                  _counter{{0, slot, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32u)}} {}
+
+        static constexpr result_type min() {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        static constexpr result_type max() {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        /**
+         * Returns the next random number of this stream.
+         * @return uniform distributed 32 bit number
+         */
+        result_type operator()() {
+            if (_bufferIndex == 4) {
+                _buffer = evaluate(_counter, _key);
+                ++_counter[0];
+                _bufferIndex = 0;
+            }
+            return _buffer[_bufferIndex++];
+        }
+
+        /**
+         * Evaluates the Philox4x32-10 bijection for a given counter and key.
+         * @param counter - the counter block
+         * @param key - the key
+         * @return four random 32 bit numbers
+         */
+        static std::array<std::uint32_t, 4> evaluate(std::array<std::uint32_t, 4> counter,
+                                                     std::array<std::uint32_t, 2> key) {
+            for (unsigned round = 0; round < ROUNDS; ++round) {
+                const std::uint64_t product0 = static_cast<std::uint64_t>(MULTIPLIER_0) * counter[0];
+                const std::uint64_t product1 = static_cast<std::uint64_t>(MULTIPLIER_1) * counter[2];
+                counter = {{static_cast<std::uint32_t>(product1 >> 32u) ^ counter[1] ^ key[0],
+                            static_cast<std::uint32_t>(product1),
+                            static_cast<std::uint32_t>(product0 >> 32u) ^ counter[3] ^ key[1],
+                            static_cast<std::uint32_t>(product0)}};
+                key[0] += WEYL_0;
+                key[1] += WEYL_1;
+            }
+            return counter;
+        }
+
+    };
+
+    /**
+     * Derives the seed of one realization of an ensemble from the base seed of the ensemble.
+     * The derived seed is the Philox bijection of the realization number (keyed by the base seed), so the seeds of
+     * different realizations are distinct and their random streams are statistically independent.
+     * @param baseSeed - the seed of the ensemble
+     * @param realization - the number of the realization
+     * @return the seed of the realization
+     */
+    inline std::uint64_t deriveSeed(std::uint64_t baseSeed, std::uint64_t realization) {
+        constexpr std::uint32_t ENSEMBLE_SLOT = 0xFFFFFFFF;
+        auto random = PhiloxEngine::evaluate(
+                {{0, ENSEMBLE_SLOT, static_cast<std::uint32_t>(realization),
+                  static_cast<std::uint32_t>(realization >> 32u)}},
+                {{static_cast<std::uint32_t>(baseSeed), static_cast<std::uint32_t>(baseSeed >> 32u)}});
+        return (static_cast<std::uint64_t>(random[1]) << 32u) | random[0];
+    }
+
+}
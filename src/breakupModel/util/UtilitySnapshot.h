@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Layout of the catalog snapshot (*.snapshot), a binary copy of a joined satellite catalog (e.g. SATCAT + TLE).
+ * A file consists of a FileHeader, a table of SourceEntry (the files the catalog was built from), the records
+ * (one CatalogRecord per satellite) and finally a string table with the names and source paths.
+ * All sections start at an ALIGNMENT aligned offset, so the records of a memory mapped file can be used in place.
+ * The numbers are stored in the byte order of the writing machine, which is recorded in the header.
+ */
+namespace util::snapshot {
+
+    /**
+     * The first bytes of every file
+     */
+    constexpr std::array<char, 8> MAGIC{{'B', 'R', 'K', 'S', 'N', 'A', 'P', '\0'}};
+
+    /**
+     * The version of the layout, a snapshot with another version is rebuilt
+     */
+    constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * Written in the byte order of the machine, a reader with a different byte order sees 0x04030201
+     */
+    constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    /**
+     * The alignment of the sections in bytes
+     */
+    constexpr std::size_t ALIGNMENT = 64;
+
+    /**
+     * The header at the beginning of a file.
+     */
+    struct FileHeader {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrderMark;
+        std::uint64_t count;
+        std::uint64_t sourceCount;
+        std::uint64_t sourceTableOffset;
+        std::uint64_t recordOffset;
+        std::uint64_t stringTableOffset;
+        std::uint64_t stringTableSize;
+    };
+
+    /**
+     * A file the catalog was built from. The snapshot is stale if the size or the content hash changes, the
+     * modification time allows to skip the hashing of unchanged files.
+     */
+    struct SourceEntry {
+        std::uint64_t size;
+        std::int64_t modificationTime;
+        std::uint64_t hash;
+        std::uint64_t pathOffset;
+        std::uint64_t pathLength;
+    };
+
+    /**
+     * One satellite of the catalog, the name is stored in the string table.
+     */
+    struct CatalogRecord {
+        std::uint64_t id;
+        std::uint64_t nameOffset;
+        std::uint32_t nameLength;
+        std::uint32_t satType;
+        double characteristicLength;
+        double areaToMassRatio;
+        double mass;
+        double area;
+        std::array<double, 6> orbitalElements;
+        double epochFraction;
+        std::int32_t epochYear;
+        std::uint32_t reserved;
+        std::array<double, 3> position;
+        std::array<double, 3> velocity;
+    };
+
+    static_assert(sizeof(FileHeader) == 64, "The FileHeader must not contain padding");
+    static_assert(sizeof(SourceEntry) == 40, "The SourceEntry must not contain padding");
+    static_assert(sizeof(CatalogRecord) == 168, "The CatalogRecord must not contain padding");
+
+    /**
+     * Rounds an offset up to the next multiple of ALIGNMENT.
+     * @param offset - in bytes
+     * @return aligned offset
+     */
+    constexpr std::size_t align(std::size_t offset) {
+        return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    /**
+     * Returns the 64 bit FNV-1a hash of the given bytes.
+     * @param bytes
+     * @return hash
+     */
+    inline std::uint64_t hash(std::string_view bytes) {
+        std::uint64_t value = 0xcbf29ce484222325ULL;
+        for (unsigned char byte : bytes) {
+            value ^= byte;
+            value *= 0x100000001b3ULL;
+        }
+        return value;
+    }
+
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <cstddef>
+#include <algorithm>
+
+namespace util {
+
+    /**
+     * Accumulates count, mean and variance of a sample without storing the sample (Welford's algorithm).
+     * Two accumulators can be merged (Chan et al.), so partial results of independent samples (e.g. from different
+     * threads) can be combined in any order.
+     * @related Chan, Tony F., Gene H. Golub, and Randall J. LeVeque. "Updating formulae and a pairwise algorithm for
+     * computing sample variances." COMPSTAT 1982.
+     */
+    class MomentAccumulator {
+
+        size_t _count{0};
+
+        double _mean{0.0};
+
+        /**
+         * Sum of the squared deviations from the mean
+         */
+        double _squaredDeviationSum{0.0};
+
+    public:
+
+        /**
+         * Adds one value to the sample.
+         * @param value
+         */
+        void add(double value) {
+            ++_count;
+            const double delta = value - _mean;
+            _mean += delta / static_cast<double>(_count);
+            _squaredDeviationSum += delta * (value - _mean);
+        }
+
+        /**
+         * Merges the sample of another accumulator into this one.
+         * @param other - accumulator of an independent sample
+         */
+        void merge(const MomentAccumulator &other) {
+            if (other._count == 0) {
+                return;
+            }
+            const size_t count = _count + other._count;
+            const double delta = other._mean - _mean;
+            const double otherWeight = static_cast<double>(other._count) / static_cast<double>(count);
+            _mean += delta * otherWeight;
+            _squaredDeviationSum += other._squaredDeviationSum
+                                    + delta * delta * static_cast<double>(_count) * otherWeight;
+            _count = count;
+        }
+
+        [[nodiscard]] size_t getCount() const {
+            return _count;
+        }
+
+        [[nodiscard]] double getMean() const {
+            return _mean;
+        }
+
+        /**
+         * Returns the unbiased sample variance.
+         * @return variance, zero if the sample contains less than two values
+         */
+        [[nodiscard]] double getVariance() const {
+            return _count < 2 ? 0.0 : _squaredDeviationSum / static_cast<double>(_count - 1);
+        }
+
+    };
+
+    /**
+     * Logarithmically spaced bins between a lower and an upper bound, framed by an underflow and an overflow bin.
+     * Bin 0 contains the values below the lower bound (including zero and NaN), bin getBinCount() - 1 the values from
+     * the upper bound on. So no value is counted under the bounds of a bin it does not belong to and the counts of all
+     * bins always sum up to the number of values.
+     */
+    class LogBinning {
+
+        double _logLower;
+
+        double _logUpper;
+
+        size_t _binCount;
+
+    public:
+
+        /**
+         * Creates the bins.
+         * @param lower - lower bound of the first regular bin (> 0)
+         * @param upper - upper bound of the last regular bin (> lower)
+         * @param binCount - number of regular bins (without underflow and overflow bin)
+         */
+        LogBinning(double lower, double upper, size_t binCount)
+                : _logLower{std::log10(lower)},
+                  _logUpper{std::log10(upper)},
+                  _binCount{binCount} {}
+
+        /**
+         * Returns the bin of a value.
+         * @param value
+         * @return bin index in [0, getBinCount()), 0 for an underflow, getBinCount() - 1 for an overflow
+         */
+        [[nodiscard]] size_t binIndex(double value) const {
+            const double position = (std::log10(value) - _logLower) / (_logUpper - _logLower)
+                                    * static_cast<double>(_binCount);
+            if (!(position >= 0.0)) {
+                return 0;
+            }
+            //Clamped before the conversion, which is undefined for infinity and positions beyond the range of size_t
+            return static_cast<size_t>(std::min(position, static_cast<double>(_binCount))) + 1;
+        }
+
+        /**
+         * Returns the lower bound of a bin.
+         * @param bin - bin index
+         * @return lower bound, zero for the underflow bin
+         */
+        [[nodiscard]] double lowerBound(size_t bin) const {
+            if (bin == 0) {
+                return 0.0;
+            }
+            return std::pow(10.0, _logLower + (_logUpper - _logLower) * static_cast<double>(bin - 1)
+                                              / static_cast<double>(_binCount));
+        }
+
+        /**
+         * Returns the upper bound of a bin.
+         * @param bin - bin index
+         * @return upper bound, infinity for the overflow bin
+         */
+        [[nodiscard]] double upperBound(size_t bin) const {
+            if (bin > _binCount) {
+                return std::numeric_limits<double>::infinity();
+            }
+            return lowerBound(bin + 1);
+        }
+
+        /**
+         * Returns the number of bins including the underflow and the overflow bin.
+         * @return number of regular bins + 2
+         */
+        [[nodiscard]] size_t getBinCount() const {
+            return _binCount + 2;
+        }
+
+    };
+
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace util {
+
+    /**
+     * Pseudo column of a ZipRange which does not reference any data but returns the index itself.
+     * This is useful if the function applied to the zipped columns requires the position of the element.
+     */
+    struct IndexColumn {
+
+        size_t operator[](size_t index) const {
+            return index;
+        }
+
+    };
+
+    /**
+     * Random access iterator over several columns of the same length (e. g. the vectors of an SoA).
+     * Dereferencing the iterator creates a tuple containing the references to the elements of each column at the
+     * current position. No tuple is stored, so iterating over the columns does not allocate anything.
+     * @tparam Columns - pointers to the first element of a column or an IndexColumn
+     */
+    template<typename ...Columns>
+    class ZipIterator {
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<decltype(std::declval<const Columns &>()[0])...>;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+
+    private:
+
+        std::tuple<Columns...> _columns;
+
+        size_t _index;
+
+    public:
+
+        ZipIterator() = default;
+
+        ZipIterator(std::tuple<Columns...> columns, size_t index)
+                : _columns{columns},
+                  _index{index} {}
+
+        reference operator*() const {
+            return (*this)[0];
+        }
+
+        reference operator[](difference_type offset) const {
+            const auto index = static_cast<size_t>(static_cast<difference_type>(_index) + offset);
+            return std::apply([index](const auto &...column) { return reference{column[index]...}; }, _columns);
+        }
+
+        /**
+         * Returns the position of this iterator in the zipped columns.
+         * @return index
+         */
+        [[nodiscard]] size_t index() const {
+            return _index;
+        }
+
+        ZipIterator &operator++() {
+            ++_index;
+            return *this;
+        }
+
+        ZipIterator operator++(int) {
+            ZipIterator copy{*this};
+            ++_index;
+            return copy;
+        }
+
+        ZipIterator &operator--() {
+            --_index;
+            return *this;
+        }
+
+        ZipIterator operator--(int) {
+            ZipIterator copy{*this};
+            --_index;
+            return copy;
+        }
+
+        ZipIterator &operator+=(difference_type offset) {
+            _index = static_cast<size_t>(static_cast<difference_type>(_index) + offset);
+            return *this;
+        }
+
+        ZipIterator &operator-=(difference_type offset) {
+            return *this += -offset;
+        }
+
+        friend ZipIterator operator+(ZipIterator it, difference_type offset) {
+            return it += offset;
+        }
+
+        friend ZipIterator operator+(difference_type offset, ZipIterator it) {
+            return it += offset;
+        }
+
+        friend ZipIterator operator-(ZipIterator it, difference_type offset) {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+        }
+
+        friend bool operator==(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return lhs._index == rhs._index;
+        }
+
+        friend bool operator!=(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return lhs._index != rhs._index;
+        }
+
+        friend bool operator<(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return lhs._index < rhs._index;
+        }
+
+        friend bool operator>(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return lhs._index > rhs._index;
+        }
+
+        friend bool operator<=(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return lhs._index <= rhs._index;
+        }
+
+        friend bool operator>=(const ZipIterator &lhs, const ZipIterator &rhs) {
+            return lhs._index >= rhs._index;
+        }
+
+    };
+
+    /**
+     * Lazy range over several columns of the same length. Can be used with the std algorithms, also with the parallel
+     * execution policies, since the iterators are random access iterators.
+     * @tparam Columns - pointers to the first element of a column or an IndexColumn
+     * @example util::ZipRange{size, util::IndexColumn{}, vector.data()} iterates over tuples (index, vector[index])
+     */
+    template<typename ...Columns>
+    class ZipRange {
+
+        std::tuple<Columns...> _columns;
+
+        size_t _size;
+
+    public:
+
+        using iterator = ZipIterator<Columns...>;
+
+        explicit ZipRange(size_t size, Columns... columns)
+                : _columns{columns...},
+                  _size{size} {}
+
+        [[nodiscard]] iterator begin() const {
+            return iterator{_columns, 0};
+        }
+
+        [[nodiscard]] iterator end() const {
+            return iterator{_columns, _size};
+        }
+
+        [[nodiscard]] size_t size() const {
+            return _size;
+        }
+
+    };
+
+    /**
+     * Returns a range over the indices [0, size) without storing them.
+     * @param size - the number of indices
+     * @return ZipRange containing only an IndexColumn
+     */
+    inline ZipRange<IndexColumn> indexRange(size_t size) {
+        return ZipRange<IndexColumn>{size, IndexColumn{}};
+    }
+
+}
@@ -3,13 +3,110 @@
 #include <memory>
 #include <exception>
 #include <chrono>
+#include <mutex>
+#include <cmath>
+#include <csignal>
 
 #include "breakupModel/input/YAMLDataReader.h"
 #include "breakupModel/input/YAMLConfigurationReader.h"
+#include "breakupModel/input/YAMLScenarioReader.h"
+#include "breakupModel/input/YAMLServiceReader.h"
 #include "breakupModel/simulation/BreakupBuilder.h"
+#include "breakupModel/simulation/Ensemble.h"
+#include "breakupModel/simulation/Scenario.h"
+#include "breakupModel/simulation/BreakupService.h"
+#include "breakupModel/simulation/EnsembleStatistics.h"
 #include "breakupModel/output/CSVWriter.h"
 #include "breakupModel/output/VTKWriter.h"
+#include "breakupModel/output/StatisticsSink.h"
+#include "breakupModel/output/EnsembleStatisticsWriter.h"
 #include "spdlog/spdlog.h"
+#include "spdlog/sinks/stdout_color_sinks.h"
+
+/**
+ * Runs all events of a scenario file. The catalog is loaded once from the inputSource of the scenario and is shared
+ * by the events, every event writes to its own output targets.
+ * @param fileName - the scenario YAML file
+ */
+void runScenario(const std::string &fileName) {
+    YAMLScenarioReader scenarioReader{fileName};
+    auto catalog = std::make_shared<const SatelliteCatalog>(scenarioReader.getDataReader()->getSatelliteCollection());
+    auto events = scenarioReader.getEvents();
+
+    std::vector<std::unique_ptr<Breakup>> breakups{};
+    for (size_t event = 0; event < events.size(); ++event) {
+        if (events[event]->getStreamingBlockSize().has_value() || events[event]->getRealizationCount().has_value()) {
+            spdlog::warn("Event {}: Streaming and ensembles are not available in a scenario and are ignored", event);
+        }
+        auto breakup = BreakupBuilder{events[event], catalog}.getBreakup();
+        breakup->setSeed(events[event]->getSeed());
+        breakups.push_back(std::move(breakup));
+    }
+
+    Scenario scenario{std::move(breakups), scenarioReader.getCurrentMaximalGivenID().value_or(catalog->getMaximalID())};
+    spdlog::info("Running a scenario with {} events", scenario.getEventCount());
+    auto start = std::chrono::high_resolution_clock::now();
+    scenario.run([&](size_t event, const Breakup &breakup) {
+        const auto &result = breakup.getResultSoA();
+        spdlog::info("Event {} produced {} fragments starting with the ID {}", event, result.size(), result.startId);
+        for (auto &out : events[event]->getOutputTargets()) {
+            out->printResult(result);
+        }
+        for (auto &inOut : events[event]->getInputTargets()) {
+            inOut->printResult(breakup.getInput());
+        }
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    spdlog::info("The scenario took {} ms", ms.count());
+}
+
+namespace {
+
+    /**
+     * The service listening on a socket, stopped by SIGINT and SIGTERM
+     */
+    BreakupService *listeningService = nullptr;
+
+    extern "C" void stopListeningService(int) {
+        if (listeningService != nullptr) {
+            listeningService->stop();
+        }
+    }
+
+}
+
+/**
+ * Runs the breakup service: the catalog is loaded once, afterwards the requests are answered until the input ends
+ * (stdin) or, for a socket, until SIGINT or SIGTERM is received. The log is written to stderr, so that it does not
+ * interfere with the responses.
+ * @param fileName - the service YAML file
+ */
+void runService(const std::string &fileName) {
+    spdlog::set_default_logger(spdlog::stderr_color_mt("service"));
+    YAMLServiceReader serviceReader{fileName};
+    auto catalog = std::make_shared<const SatelliteCatalog>(serviceReader.getDataReader()->getSatelliteCollection());
+    spdlog::info("The service loaded a catalog of {} satellites", catalog->size());
+    auto workerCount = serviceReader.getWorkerCount();
+    BreakupService service{catalog, serviceReader.getCurrentMaximalGivenID().value_or(catalog->getMaximalID()),
+                           workerCount.value_or(std::max(1u, std::thread::hardware_concurrency()))};
+    auto socketPath = serviceReader.getSocketPath();
+    if (socketPath.has_value()) {
+        listeningService = &service;
+        std::signal(SIGINT, stopListeningService);
+        std::signal(SIGTERM, stopListeningService);
+        service.listen(socketPath.value());
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+        listeningService = nullptr;
+    } else {
+        std::ios::sync_with_stdio(false);
+        service.serve(std::cin, [](const std::string &response) {
+            std::cout.write(response.data(), static_cast<std::streamsize>(response.size()));
+            std::cout.flush();
+        });
+    }
+}
 
 int main(int argc, char *argv[]) {
 
@@ -26,6 +123,18 @@ int main(int argc, char *argv[]) {
         //The fileName of the YAML file
         std::string fileName{argv[1]};
 
+        //The service answers requests against a catalog which is loaded only once
+        if (YAMLServiceReader::isService(fileName)) {
+            runService(fileName);
+            return 0;
+        }
+
+        //A scenario contains several events instead of a single simulation
+        if (YAMLScenarioReader::isScenario(fileName)) {
+            runScenario(fileName);
+            return 0;
+        }
+
         //Load an Configuration Source containing the input arguments required for the BreakupBuilder
         //The YAMLConfigurationReader as a special case is also able to load the Configuration for Output
         auto configSource = std::make_shared<YAMLConfigurationReader>(fileName);
@@ -35,19 +144,74 @@ int main(int argc, char *argv[]) {
 
         //Create and run the simulation or catch an exception in case something is wrong with the simulation
         //Creates and Runs the simulation
+        auto realizationCount = configSource->getRealizationCount();
+        if (realizationCount.has_value()) {
+            //Monte Carlo ensemble: every realization is written to its own output files
+            //and/ or reduced into the aggregated statistics
+            Ensemble ensemble{breakupBuilder, realizationCount.value(), configSource->getSeed()};
+            spdlog::info("Running {} realizations with the base seed {}", ensemble.getRealizationCount(),
+                         ensemble.getBaseSeed());
+            auto statisticsTarget = configSource->getStatisticsTarget();
+            EnsembleStatistics statistics{};
+            std::mutex statisticsMutex{};
+            auto start = std::chrono::high_resolution_clock::now();
+            ensemble.run([&](size_t realization, const Breakup &breakup) {
+                spdlog::debug("Realization {} produced {} fragments", realization, breakup.getResultSoA().size());
+                for (auto &out : configSource->getOutputTargets("_" + std::to_string(realization))) {
+                    out->printResult(breakup.getResultSoA());
+                }
+                if (statisticsTarget.has_value()) {
+                    EnsembleStatistics realizationStatistics{};
+                    realizationStatistics.add(breakup.getResultSoA());
+                    std::lock_guard<std::mutex> lock{statisticsMutex};
+                    statistics.merge(realizationStatistics);
+                }
+            });
+            auto end = std::chrono::high_resolution_clock::now();
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+            spdlog::info("The ensemble took {} ms", ms.count());
+            if (statisticsTarget.has_value()) {
+                spdlog::info("The realizations produced {} +- {} fragments", statistics.getFragmentCount().getMean(),
+                             std::sqrt(statistics.getFragmentCount().getVariance()));
+                EnsembleStatisticsWriter{statisticsTarget.value()}.printResult(statistics);
+            }
+            //Print output for the input defined by the OutputConfigurationSource aka the YAMLConfigurationReader
+            for (auto &inOut : configSource->getInputTargets()) {
+                inOut->printResult(breakupBuilder.getBreakup()->getInput());
+            }
+            return 0;
+        }
+
         auto breakUpSimulation = breakupBuilder.getBreakup();
+        breakUpSimulation->setSeed(configSource->getSeed());
+        auto streamingBlockSize = configSource->getStreamingBlockSize();
+        //In the streaming mode every target must be a FragmentSink, this fails before the simulation is run
+        std::vector<std::shared_ptr<OutputWriter>> outputTargets{};
+        std::vector<std::shared_ptr<FragmentSink>> sinks{};
+        if (streamingBlockSize.has_value()) {
+            sinks = configSource->getStreamingTargets();
+            sinks.insert(sinks.begin(), std::make_shared<StatisticsSink>());
+        } else {
+            outputTargets = configSource->getOutputTargets();
+        }
         auto start = std::chrono::high_resolution_clock::now();
-        breakUpSimulation->run();
+        if (streamingBlockSize.has_value()) {
+            //Streams the fragments block by block to the output targets
+            breakUpSimulation->runStreaming(sinks, streamingBlockSize.value());
+        } else {
+            breakUpSimulation->run();
+        }
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = end - start;
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
         spdlog::info("The simulation took {} ms", ms.count());
-        spdlog::info("The simulation produced {} fragments", breakUpSimulation->getResultSoA().size());
 
-        //Prints the the output to files defined by the OutputConfigurationSource aka the YAMLConfigurationReader
-        auto outputTargets = configSource->getOutputTargets();
-        for (auto &out : outputTargets) {
-            out->printResult(breakUpSimulation->getResult());
+        if (!streamingBlockSize.has_value()) {
+            spdlog::info("The simulation produced {} fragments", breakUpSimulation->getResultSoA().size());
+            //Prints the the output to files defined by the OutputConfigurationSource aka the YAMLConfigurationReader
+            for (auto &out : outputTargets) {
+                out->printResult(breakUpSimulation->getResultSoA());
+            }
         }
         //Print output for the input defined by the OutputConfigurationSource aka the YAMLConfigurationReader
         auto inputTargets = configSource->getInputTargets();
@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include "breakupModel/input/BinaryResultReader.h"
+#include "breakupModel/output/BinaryWriter.h"
+
+class BinaryResultReaderTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        _satellites = Satellites{24946, SatType::DEBRIS, {1.0, 2.0, 3.0}, 5};
+        _satellites.nameTable = {std::make_shared<const std::string>("Iridium 33-Collision-Fragment"),
+                                 std::make_shared<const std::string>("Kosmos 2251-Collision-Fragment")};
+        for (size_t i = 0; i < _satellites.size(); ++i) {
+            const auto d = static_cast<double>(i + 1);
+            _satellites.parent[i] = static_cast<std::uint8_t>(i % 2);
+            _satellites.characteristicLength[i] = 0.1 * d;
+            _satellites.areaToMassRatio[i] = 0.01 * d;
+            _satellites.mass[i] = 10.0 * d;
+            _satellites.area[i] = 0.5 * d;
+            _satellites.ejectionVelocity[i] = {d, 2.0 * d, 3.0 * d};
+            _satellites.velocity[i] = {7000.0 + d, -d, 0.5 * d};
+        }
+    }
+
+    virtual void TearDown() {
+        std::remove(_filePath.c_str());
+    }
+
+    const std::string _filePath{"binaryResultReaderTest.bin"};
+
+    Satellites _satellites;
+
+};
+
+TEST_F(BinaryResultReaderTest, RoundTrip) {
+    BinaryWriter{_filePath}.printResult(_satellites);
+
+    BinaryResultReader reader{_filePath};
+    const SatellitesView &view = reader.getSatellites();
+
+    ASSERT_EQ(view.size(), _satellites.size());
+    ASSERT_EQ(view.startId, _satellites.startId);
+    ASSERT_EQ(view.satType, _satellites.satType);
+    ASSERT_EQ(view.position, _satellites.position);
+    for (size_t i = 0; i < view.size(); ++i) {
+        EXPECT_EQ(view.getName(i), _satellites.getName(i));
+        EXPECT_EQ(view.characteristicLength[i], _satellites.characteristicLength[i]);
+        EXPECT_EQ(view.areaToMassRatio[i], _satellites.areaToMassRatio[i]);
+        EXPECT_EQ(view.mass[i], _satellites.mass[i]);
+        EXPECT_EQ(view.area[i], _satellites.area[i]);
+        EXPECT_EQ(view.ejectionVelocity[i], _satellites.ejectionVelocity[i]);
+        EXPECT_EQ(view.velocity[i], _satellites.velocity[i]);
+    }
+
+    //The columns are aligned so they can be used in place
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.velocity) % util::binary::ALIGNMENT, 0);
+}
+
+TEST_F(BinaryResultReaderTest, AoSRoundTrip) {
+    BinaryWriter{_filePath}.printResult(_satellites.getAoS());
+
+    BinaryResultReader reader{_filePath};
+    const auto aos = reader.getSatellites().toSatellites().getAoS();
+    const auto expected = _satellites.getAoS();
+
+    ASSERT_EQ(aos.size(), expected.size());
+    for (size_t i = 0; i < aos.size(); ++i) {
+        EXPECT_EQ(aos[i].getId(), expected[i].getId());
+        EXPECT_EQ(aos[i].getName(), expected[i].getName());
+        EXPECT_EQ(aos[i].getMass(), expected[i].getMass());
+        EXPECT_EQ(aos[i].getVelocity(), expected[i].getVelocity());
+    }
+}
+
+TEST_F(BinaryResultReaderTest, AoSWithoutSharedPropertiesThrows) {
+    auto aos = _satellites.getAoS();
+    aos.back().setPosition({0.0, 0.0, 0.0});
+
+    EXPECT_THROW(BinaryWriter{_filePath}.printResult(aos), std::invalid_argument);
+}
+
+TEST_F(BinaryResultReaderTest, InvalidFileThrows) {
+    {
+        std::ofstream file{_filePath};
+        file << "ID,Name,Satellite Type\n";
+    }
+    EXPECT_THROW(BinaryResultReader{_filePath}, std::runtime_error);
+    EXPECT_THROW(BinaryResultReader{"nonExistingFile.bin"}, std::runtime_error);
+}
+
+TEST_F(BinaryResultReaderTest, CorruptedFileThrows) {
+    using namespace util::binary;
+    BinaryWriter{_filePath}.printResult(_satellites);
+    FileHeader header{};
+    ColumnEntry parentColumn{};
+    {
+        std::ifstream file{_filePath, std::ios::binary};
+        file.read(reinterpret_cast<char *>(&header), sizeof(FileHeader));
+        file.seekg(static_cast<std::streamoff>(header.columnTableOffset));
+        do {
+            file.read(reinterpret_cast<char *>(&parentColumn), sizeof(ColumnEntry));
+        } while (file && std::string{parentColumn.name.data()} != "parent");
+        ASSERT_TRUE(file);
+    }
+    auto overwrite = [this](size_t offset, const auto &value) {
+        std::fstream file{_filePath, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+
+    //A parent index without a name
+    overwrite(parentColumn.offset + 3, std::uint8_t{2});
+    EXPECT_THROW(BinaryResultReader{_filePath}, std::runtime_error);
+    overwrite(parentColumn.offset + 3, std::uint8_t{1});
+    EXPECT_NO_THROW(BinaryResultReader{_filePath});
+
+    //A satType without a SatType
+    overwrite(offsetof(FileHeader, satType), std::uint32_t{42});
+    EXPECT_THROW(BinaryResultReader{_filePath}, std::runtime_error);
+    overwrite(offsetof(FileHeader, satType), header.satType);
+
+    //A name table beyond the end of the file, also if the offset plus a length would overflow
+    const auto fileSize = static_cast<std::uint64_t>(std::filesystem::file_size(_filePath));
+    for (std::uint64_t nameTableOffset : {fileSize - 4, fileSize + 1, UINT64_MAX - 3}) {
+        overwrite(offsetof(FileHeader, nameTableOffset), nameTableOffset);
+        EXPECT_THROW(BinaryResultReader{_filePath}, std::runtime_error) << nameTableOffset;
+    }
+    overwrite(offsetof(FileHeader, nameTableOffset), header.nameTableOffset);
+    EXPECT_NO_THROW(BinaryResultReader{_filePath});
+}
@@ -50,6 +50,32 @@ TEST_F(CSVReaderTest, readLines) {
     ASSERT_EQ(actualTuple[2], expectedTuple03);
     ASSERT_EQ(actualTuple[3], expectedTuple04);
 }
+/**
+ * Only the given columns are read in the given order, the others are skipped
+ */
+TEST_F(CSVReaderTest, readProjectedColumns) {
+    CSVReader<double, std::string, size_t, SatType> satcatReader{"resources/SatcatReaderTest01.csv", true,
+                                                                 {13, 0, 2, 3}};
+
+    std::array<std::string, 4> expectedHeader{"RCS", "OBJECT_NAME", "NORAD_CAT_ID", "OBJECT_TYPE"};
+    EXPECT_EQ(satcatReader.getHeader(), expectedHeader);
+
+    auto actualTuple = satcatReader.getLines();
+
+    ASSERT_EQ(actualTuple.size(), 4);
+    EXPECT_EQ(actualTuple[0], std::make_tuple(20.42, "SL-1 R/B", 1, SatType::ROCKET_BODY));
+    EXPECT_EQ(actualTuple[1], std::make_tuple(0.0, "SPUTNIK 1", 2, SatType::SPACECRAFT));
+    EXPECT_EQ(actualTuple[3], std::make_tuple(0.0, "EXPLORER 1", 4, SatType::SPACECRAFT));
+}
+
+/**
+ * A column can only be read once
+ */
+TEST_F(CSVReaderTest, readSameColumnTwiceThrows) {
+    using Reader = CSVReader<std::string, std::string>;
+    EXPECT_THROW((Reader{"resources/SatcatReaderTest01.csv", true, {0, 0}}), std::invalid_argument);
+}
+
 /**
  * Correctly parsed
  */
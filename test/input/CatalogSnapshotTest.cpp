@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <cstddef>
+#include <cstdint>
+#include "breakupModel/input/CatalogSnapshot.h"
+#include "breakupModel/input/TLESatcatDataReader.h"
+#include "breakupModel/util/UtilitySnapshot.h"
+
+class CatalogSnapshotTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        std::filesystem::copy_file("resources/SatcatReaderTest01.csv", _satcatPath,
+                                   std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::copy_file("resources/TLESatcatReaderTest01.txt", _tlePath,
+                                   std::filesystem::copy_options::overwrite_existing);
+        _expectedSatellites = TLESatcatDataReader{_satcatPath, _tlePath}.getSatelliteCollection();
+    }
+
+    virtual void TearDown() {
+        try {
+            std::filesystem::remove(_snapshotPath);
+            std::filesystem::remove(_satcatPath);
+            std::filesystem::remove(_tlePath);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    const std::string _snapshotPath{"resources/catalogSnapshotTest.snapshot"};
+
+    const std::string _satcatPath{"resources/catalogSnapshotTestSatcat.csv"};
+
+    const std::string _tlePath{"resources/catalogSnapshotTestTLE.txt"};
+
+    std::vector<Satellite> _expectedSatellites;
+
+    /**
+     * Reads a value of the snapshot file at the given offset.
+     */
+    template<typename T>
+    T readAt(std::uint64_t offset) const {
+        std::ifstream file{_snapshotPath, std::ios::binary};
+        file.seekg(static_cast<std::streamoff>(offset));
+        T value{};
+        file.read(reinterpret_cast<char *>(&value), sizeof(T));
+        return value;
+    }
+
+    /**
+     * Overwrites a value of the snapshot file at the given offset.
+     */
+    template<typename T>
+    void writeAt(std::uint64_t offset, const T &value) const {
+        std::fstream file{_snapshotPath, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+};
+
+TEST_F(CatalogSnapshotTest, BuildAndLoad) {
+    CatalogSnapshot catalogSnapshot{_snapshotPath, _satcatPath, _tlePath};
+    ASSERT_FALSE(catalogSnapshot.isUpToDate());
+
+    //The first call builds the snapshot, the second one reads it
+    catalogSnapshot.getSatelliteCollection();
+    ASSERT_TRUE(catalogSnapshot.isUpToDate());
+    auto actualSatellites = catalogSnapshot.getSatelliteCollection();
+
+    ASSERT_EQ(actualSatellites.size(), _expectedSatellites.size());
+    for (size_t i = 0; i < actualSatellites.size(); ++i) {
+        const auto &actual = actualSatellites[i];
+        const auto &expected = _expectedSatellites[i];
+        EXPECT_EQ(actual.getId(), expected.getId());
+        EXPECT_EQ(actual.getName(), expected.getName());
+        EXPECT_EQ(actual.getSatType(), expected.getSatType());
+        EXPECT_EQ(actual.getMass(), expected.getMass());
+        EXPECT_EQ(actual.getArea(), expected.getArea());
+        EXPECT_EQ(actual.getCharacteristicLength(), expected.getCharacteristicLength());
+        EXPECT_EQ(actual.getPosition(), expected.getPosition());
+        EXPECT_EQ(actual.getVelocity(), expected.getVelocity());
+        EXPECT_EQ(actual.getOrbitalElements(), expected.getOrbitalElements());
+    }
+}
+
+TEST_F(CatalogSnapshotTest, ChangedSourceRebuildsSnapshot) {
+    CatalogSnapshot catalogSnapshot{_snapshotPath, _satcatPath, _tlePath};
+    catalogSnapshot.getSatelliteCollection();
+
+    //A new modification time with the same content keeps the snapshot valid
+    std::filesystem::last_write_time(_tlePath, std::filesystem::last_write_time(_tlePath) + std::chrono::hours{1});
+    EXPECT_TRUE(catalogSnapshot.isUpToDate());
+
+    //Only the first satellite is left in the SATCAT
+    {
+        std::ifstream satcatIn{"resources/SatcatReaderTest01.csv"};
+        std::string header, firstRow;
+        std::getline(satcatIn, header);
+        std::getline(satcatIn, firstRow);
+        std::ofstream satcatOut{_satcatPath, std::ios::trunc};
+        satcatOut << header << '\n' << firstRow << '\n';
+    }
+    EXPECT_FALSE(catalogSnapshot.isUpToDate());
+    EXPECT_EQ(catalogSnapshot.getSatelliteCollection().size(), 1);
+
+    //The snapshot without given sources uses the recorded ones
+    CatalogSnapshot recordedSources{_snapshotPath};
+    EXPECT_TRUE(recordedSources.isUpToDate());
+    EXPECT_EQ(recordedSources.getSatelliteCollection().size(), 1);
+}
+
+TEST_F(CatalogSnapshotTest, InvalidSnapshotWithoutSourcesThrows) {
+    {
+        std::ofstream file{_snapshotPath, std::ios::trunc};
+        file << "no snapshot";
+    }
+    CatalogSnapshot catalogSnapshot{_snapshotPath};
+    EXPECT_FALSE(catalogSnapshot.isUpToDate());
+    EXPECT_THROW(catalogSnapshot.getSatelliteCollection(), std::runtime_error);
+}
+
+TEST_F(CatalogSnapshotTest, TouchedSourceIsRecorded) {
+    using namespace util::snapshot;
+    CatalogSnapshot catalogSnapshot{_snapshotPath, _satcatPath, _tlePath};
+    catalogSnapshot.getSatelliteCollection();
+
+    //The temporary file was renamed, no other file is left next to the snapshot
+    for (const auto &entry : std::filesystem::directory_iterator{"resources"}) {
+        EXPECT_EQ(entry.path().filename().string().find("catalogSnapshotTest.snapshot."), std::string::npos);
+    }
+
+    const auto touched = std::filesystem::last_write_time(_tlePath) + std::chrono::hours{1};
+    std::filesystem::last_write_time(_tlePath, touched);
+    ASSERT_TRUE(catalogSnapshot.isUpToDate());
+
+    //The unchanged content was hashed once, afterwards the new modification time is recorded in the snapshot
+    const auto header = readAt<FileHeader>(0);
+    ASSERT_EQ(header.sourceCount, 2);
+    const auto tleEntry = readAt<SourceEntry>(header.sourceTableOffset + sizeof(SourceEntry));
+    EXPECT_EQ(tleEntry.modificationTime,
+              std::chrono::duration_cast<std::chrono::nanoseconds>(touched.time_since_epoch()).count());
+    EXPECT_TRUE(catalogSnapshot.isUpToDate());
+}
+
+TEST_F(CatalogSnapshotTest, CorruptRecordThrows) {
+    using namespace util::snapshot;
+    CatalogSnapshot catalogSnapshot{_snapshotPath, _satcatPath, _tlePath};
+    catalogSnapshot.getSatelliteCollection();
+    const auto header = readAt<FileHeader>(0);
+
+    //Invalid satellite type
+    writeAt<std::uint32_t>(header.recordOffset + offsetof(CatalogRecord, satType), 42);
+    EXPECT_THROW(CatalogSnapshot{_snapshotPath}.getSatelliteCollection(), std::runtime_error);
+
+    //Name outside of the string table (the offset would overflow when added to the length)
+    writeAt<std::uint32_t>(header.recordOffset + offsetof(CatalogRecord, satType), 0);
+    writeAt<std::uint64_t>(header.recordOffset + offsetof(CatalogRecord, nameOffset), ~std::uint64_t{0});
+    EXPECT_THROW(CatalogSnapshot{_snapshotPath}.getSatelliteCollection(), std::runtime_error);
+}
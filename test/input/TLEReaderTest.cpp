@@ -3,6 +3,8 @@
 #include <string>
 #include <array>
 #include <utility>
+#include <fstream>
+#include <cstdio>
 #include "breakupModel/input/TLEReader.h"
 #include "breakupModel/model/OrbitalElementsFactory.h"
 
@@ -86,3 +88,30 @@ TEST_F(TLEReaderTest, readTLE_04_Test) {
     ASSERT_EQ(actualKepler, _expectedKepler_3);
 }
 
+
+TEST_F(TLEReaderTest, SortedIDOrbitalElements) {
+    TLEReader tleReader{"resources/TLEReaderTest03.txt"};
+
+    auto elements = tleReader.getSortedIDOrbitalElements();
+
+    ASSERT_EQ(elements.size(), 2);
+    ASSERT_EQ(elements[0].first, _expectedID_1);
+    ASSERT_EQ(elements[0].second, _expectedKepler_1);
+    ASSERT_EQ(elements[1].first, _expectedID_2);
+    ASSERT_EQ(elements[1].second, _expectedKepler_2);
+}
+
+TEST_F(TLEReaderTest, MalformedTLEThrows) {
+    const std::string filepath{"resources/TLEReaderTestMalformed.txt"};
+    {
+        std::ofstream file{filepath};
+        file << "1 25544U 98067A   08264.51782528 -.00002182  00000-0 -11606-4 0  2927\n"
+             << "2 25544  51.6416 247.4627 0006703 130.5360 325.0288 15.72125391563537\n"
+             << "1 48808U 21047A   ab179.92803759 -.00000367  00000-0  00000-0 0  9993\n"
+             << "2 48808   0.0541 226.6478 0000694 252.0694 256.3446  1.00272877   387\n";
+    }
+    TLEReader tleReader{filepath};
+
+    EXPECT_THROW(tleReader.getSortedIDOrbitalElements(), std::runtime_error);
+    std::remove(filepath.c_str());
+}
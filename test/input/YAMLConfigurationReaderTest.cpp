@@ -14,6 +14,7 @@ TEST(YAMLConfigurationReaderTest, ConfigTest01_Normal) {
     EXPECT_EQ(yamlReader.getTypeOfSimulation(), SimulationType::COLLISION);
     EXPECT_EQ(yamlReader.getCurrentMaximalGivenID().value(), 48514);
     EXPECT_EQ(yamlReader.getIDFilter().value(), expectedIDFilter);
+    EXPECT_EQ(yamlReader.getExecutionMode(), ExecutionMode::FUSED);
 
 
     EXPECT_EQ(yamlReader.getInputTargets().size(), 1);
@@ -29,6 +30,7 @@ TEST(YAMLConfigurationReaderTest, ConfigTest02_Normal) {
     EXPECT_EQ(yamlReader.getTypeOfSimulation(), SimulationType::COLLISION);
     EXPECT_EQ(yamlReader.getCurrentMaximalGivenID(), std::nullopt);
     EXPECT_EQ(yamlReader.getIDFilter().value(), expectedIDFilter);
+    EXPECT_EQ(yamlReader.getExecutionMode(), ExecutionMode::STAGED);
 
 
     EXPECT_EQ(yamlReader.getInputTargets().size(), 0);
@@ -59,3 +61,19 @@ TEST(YAMLConfigurationReaderTest, ConfigTest05_NoSimTag) {
                                         "an exception";
 }
 
+
+TEST(YAMLConfigurationReaderTest, ConfigTest06_StreamingWithBinaryTargetThrows) {
+    YAMLConfigurationReader yamlReader{"resources/YamlConfigurationReaderTest05.yaml"};
+
+    EXPECT_EQ(yamlReader.getStreamingBlockSize().value(), 1000);
+    //Without streaming both targets are fine
+    EXPECT_EQ(yamlReader.getOutputTargets().size(), 2);
+    //The .bin target requires the whole result and cannot be streamed, so it must not be skipped silently
+    EXPECT_THROW(yamlReader.getStreamingTargets(), std::runtime_error);
+}
+
+TEST(YAMLConfigurationReaderTest, ConfigTest07_StreamingTargets) {
+    YAMLConfigurationReader yamlReader{"resources/YamlConfigurationReaderTest01.yaml"};
+
+    EXPECT_EQ(yamlReader.getStreamingTargets().size(), yamlReader.getOutputTargets().size());
+}
@@ -130,3 +130,36 @@ TEST_F(YAMLReaderTest, getSatelliteCollectionTest04) {
                                                                              "satellites tag inside the YAML file";
 
 }
+
+/**
+ * Several satellites take their Kepler elements from the same TLE file
+ */
+TEST_F(YAMLReaderTest, getSatelliteCollectionFromTLE) {
+    YAMLDataReader yamlReader{"resources/YamlDataReaderTest05.yaml"};
+    auto satelliteCollection = yamlReader.getSatelliteCollection();
+
+    ASSERT_EQ(satelliteCollection.size(), 2);
+
+    TLEReader tleReader{"resources/TLESatcatReaderTest01.txt"};
+    auto mapping = tleReader.getMappingIDOrbitalElements();
+    for (const auto &satellite : satelliteCollection) {
+        SatelliteBuilder satelliteBuilder{};
+        auto expected = satelliteBuilder
+                .setID(satellite.getId())
+                .setSatType(satellite.getSatType())
+                .setMass(satellite.getMass())
+                .setOrbitalElements(mapping.at(satellite.getId()))
+                .getResult();
+        EXPECT_EQ(satellite.getPosition(), expected.getPosition());
+        EXPECT_EQ(satellite.getVelocity(), expected.getVelocity());
+    }
+}
+
+/**
+ * The TLE file does not contain the second satellite
+ */
+TEST_F(YAMLReaderTest, getSatelliteCollectionFromTLEMissingID) {
+    YAMLDataReader yamlReader{"resources/YamlDataReaderTest06.yaml"};
+
+    ASSERT_THROW(yamlReader.getSatelliteCollection(), std::runtime_error);
+}
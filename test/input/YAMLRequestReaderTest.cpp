@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+
+#include <set>
+#include "breakupModel/input/YAMLRequestReader.h"
+
+TEST(YAMLRequestReaderTest, CatalogRequest) {
+    YAMLRequestReader requestReader{"{id: 7, idFilter: [1, 2], minimalCharacteristicLength: 0.1, "
+                                    "simulationType: CO, currentMaxID: 48514, seed: 42, format: binary}"};
+
+    EXPECT_EQ(requestReader.getRequestID().value(), 7);
+    EXPECT_EQ(requestReader.getResultFormat(), ResultFormat::BINARY);
+    EXPECT_EQ(requestReader.getSeed().value(), 42);
+    EXPECT_EQ(requestReader.getMinimalCharacteristicLength(), 0.1);
+    EXPECT_EQ(requestReader.getTypeOfSimulation(), SimulationType::COLLISION);
+    EXPECT_EQ(requestReader.getCurrentMaximalGivenID().value(), 48514);
+    EXPECT_EQ(requestReader.getIDFilter().value(), (std::set<size_t>{1, 2}));
+    EXPECT_FALSE(requestReader.getEnforceMassConservation());
+    EXPECT_EQ(requestReader.getExecutionMode(), ExecutionMode::STAGED);
+    EXPECT_FALSE(requestReader.hasSatellites());
+    EXPECT_THROW(requestReader.getDataReader(), std::runtime_error);
+}
+
+TEST(YAMLRequestReaderTest, InlineSatellitesRequest) {
+    //JSON is valid YAML, too
+    YAMLRequestReader requestReader{R"({"minimalCharacteristicLength": 0.05, "enforceMassConservation": true,
+                                       "executionMode": "FUSED",
+                                       "satellites": [{"id": 12, "mass": 800.0, "velocity": [1.0, 2.0, 3.0]}]})"};
+
+    EXPECT_FALSE(requestReader.getRequestID().has_value());
+    EXPECT_EQ(requestReader.getResultFormat(), ResultFormat::CSV);
+    EXPECT_EQ(requestReader.getTypeOfSimulation(), SimulationType::UNKNOWN);
+    EXPECT_TRUE(requestReader.getEnforceMassConservation());
+    EXPECT_EQ(requestReader.getExecutionMode(), ExecutionMode::FUSED);
+    ASSERT_TRUE(requestReader.hasSatellites());
+
+    auto satellites = requestReader.getDataReader()->getSatelliteCollection();
+    ASSERT_EQ(satellites.size(), 1);
+    EXPECT_EQ(satellites[0].getId(), 12);
+    EXPECT_EQ(satellites[0].getMass(), 800.0);
+}
+
+TEST(YAMLRequestReaderTest, TLEFileReferenceThrows) {
+    YAMLRequestReader requestReader{"{minimalCharacteristicLength: 0.05, "
+                                    "satellites: [{id: 12, mass: 800.0, velocity: [1.0, 2.0, 3.0]}, "
+                                    "{id: 13, mass: 800.0, kepler: resources/TLEReaderTest01.txt}]}"};
+
+    ASSERT_TRUE(requestReader.hasSatellites());
+    EXPECT_THROW(requestReader.getDataReader(), std::runtime_error);
+}
+
+TEST(YAMLRequestReaderTest, MalformedRequestThrows) {
+    EXPECT_THROW(YAMLRequestReader{"[1, 2]"}, std::runtime_error);
+    EXPECT_THROW(YAMLRequestReader{"{format: xml}"}.getResultFormat(), std::runtime_error);
+    EXPECT_THROW(YAMLRequestReader{"{simulationType: IMPACT}"}.getTypeOfSimulation(), std::runtime_error);
+    EXPECT_THROW(YAMLRequestReader{"{executionMode: PARALLEL}"}.getExecutionMode(), std::runtime_error);
+    EXPECT_THROW(YAMLRequestReader{"{idFilter: [1]}"}.getMinimalCharacteristicLength(), std::runtime_error);
+}
@@ -0,0 +1,38 @@
+#include "gtest/gtest.h"
+
+#include <set>
+#include "breakupModel/input/YAMLScenarioReader.h"
+#include "breakupModel/util/UtilityRandom.h"
+
+TEST(YAMLScenarioReaderTest, ScenarioTest01_Normal) {
+    ASSERT_TRUE(YAMLScenarioReader::isScenario("resources/YamlScenarioReaderTest01.yaml"));
+    ASSERT_FALSE(YAMLScenarioReader::isScenario("resources/YamlConfigurationReaderTest01.yaml"));
+
+    YAMLScenarioReader scenarioReader{"resources/YamlScenarioReaderTest01.yaml"};
+
+    EXPECT_EQ(scenarioReader.getCurrentMaximalGivenID().value(), 48514);
+    EXPECT_EQ(scenarioReader.getDataReader()->getSatelliteCollection().size(), 5);
+
+    auto events = scenarioReader.getEvents();
+    ASSERT_EQ(events.size(), 2);
+
+    EXPECT_EQ(events[0]->getTypeOfSimulation(), SimulationType::COLLISION);
+    EXPECT_EQ(events[0]->getIDFilter().value(), (std::set<size_t>{1, 2}));
+    EXPECT_EQ(events[0]->getOutputTargets().size(), 1);
+    //The seed is derived from the seed of the scenario if the event has none
+    EXPECT_EQ(events[0]->getSeed().value(), util::deriveSeed(42, 0));
+
+    EXPECT_EQ(events[1]->getTypeOfSimulation(), SimulationType::EXPLOSION);
+    EXPECT_EQ(events[1]->getMinimalCharacteristicLength(), 0.05);
+    EXPECT_EQ(events[1]->getSeed().value(), 7);
+}
+
+TEST(YAMLScenarioReaderTest, ScenarioTest02_EventWithInputSourceThrows) {
+    YAMLScenarioReader scenarioReader{"resources/YamlScenarioReaderTest02.yaml"};
+
+    ASSERT_THROW(scenarioReader.getEvents(), std::runtime_error);
+}
+
+TEST(YAMLScenarioReaderTest, ScenarioTest03_NoScenarioThrows) {
+    ASSERT_THROW(YAMLScenarioReader{"resources/YamlConfigurationReaderTest01.yaml"}, std::runtime_error);
+}
@@ -0,0 +1,19 @@
+#include "gtest/gtest.h"
+
+#include "breakupModel/input/YAMLServiceReader.h"
+
+TEST(YAMLServiceReaderTest, ServiceTest01_Normal) {
+    ASSERT_TRUE(YAMLServiceReader::isService("resources/YamlServiceReaderTest01.yaml"));
+    ASSERT_FALSE(YAMLServiceReader::isService("resources/YamlScenarioReaderTest01.yaml"));
+
+    YAMLServiceReader serviceReader{"resources/YamlServiceReaderTest01.yaml"};
+
+    EXPECT_EQ(serviceReader.getCurrentMaximalGivenID().value(), 48514);
+    EXPECT_EQ(serviceReader.getDataReader()->getSatelliteCollection().size(), 5);
+    EXPECT_EQ(serviceReader.getSocketPath().value(), "/tmp/breakupService.sock");
+    EXPECT_EQ(serviceReader.getWorkerCount().value(), 4);
+}
+
+TEST(YAMLServiceReaderTest, ServiceTest02_NoServiceThrows) {
+    ASSERT_THROW(YAMLServiceReader{"resources/YamlScenarioReaderTest01.yaml"}, std::runtime_error);
+}
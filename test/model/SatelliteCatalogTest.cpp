@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <set>
+#include "breakupModel/model/SatelliteCatalog.h"
+
+class SatelliteCatalogTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        for (size_t id : {42, 7, 1000, 3, 7}) {
+            _satellites.emplace_back(id);
+        }
+        _satellites[1].setName("first");
+        _satellites[4].setName("second");
+    }
+
+    std::vector<Satellite> _satellites;
+
+};
+
+/**
+ * The selection contains all satellites with the given IDs in the order of the catalog
+ */
+TEST_F(SatelliteCatalogTest, Select) {
+    SatelliteCatalog catalog{_satellites};
+
+    auto selection = catalog.select({1000, 42});
+    ASSERT_EQ(selection.size(), 2);
+    EXPECT_EQ(selection[0].getId(), 42);
+    EXPECT_EQ(selection[1].getId(), 1000);
+
+    //Duplicates are all selected, unknown IDs are ignored
+    selection = catalog.select({7, 12345});
+    ASSERT_EQ(selection.size(), 2);
+    EXPECT_EQ(selection[0].getName(), "first");
+    EXPECT_EQ(selection[1].getName(), "second");
+}
+
+TEST_F(SatelliteCatalogTest, MaximalID) {
+    EXPECT_EQ(SatelliteCatalog{_satellites}.getMaximalID(), 1000);
+    EXPECT_EQ(SatelliteCatalog{}.getMaximalID(), 0);
+    EXPECT_TRUE(SatelliteCatalog{}.select({1}).empty());
+}
@@ -0,0 +1,43 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include "breakupModel/model/Satellites.h"
+
+/**
+ * The nameTable holds at most 256 names since the parent index is an uint8_t
+ */
+TEST(SatellitesTest, AppendNameThrowsIfTableIsFull) {
+    Satellites satellites{1, SatType::DEBRIS, {0, 0, 0}, 1};
+    for (size_t i = 0; i < Satellites::MAX_NAME_COUNT; ++i) {
+        EXPECT_EQ(satellites.appendName(std::make_shared<const std::string>(std::to_string(i))), i);
+    }
+    EXPECT_THROW(satellites.appendName(std::make_shared<const std::string>("one too many")), std::length_error);
+    EXPECT_EQ(satellites.nameTable.size(), Satellites::MAX_NAME_COUNT);
+}
+
+TEST(SatellitesTest, FromAoSWithTooManyNamesThrows) {
+    std::vector<Satellite> satelliteCollection{};
+    for (size_t i = 0; i <= Satellites::MAX_NAME_COUNT; ++i) {
+        satelliteCollection.emplace_back(i + 1);
+        satelliteCollection.back().setName(std::to_string(i));
+    }
+    EXPECT_THROW(Satellites::fromAoS(satelliteCollection), std::length_error);
+
+    //With one name less the names are resolved again
+    satelliteCollection.pop_back();
+    Satellites satellites = Satellites::fromAoS(satelliteCollection);
+    EXPECT_EQ(satellites.getName(255), "255");
+}
+
+TEST(SatellitesTest, InvalidParentIndexThrows) {
+    Satellites satellites{1, SatType::DEBRIS, {0, 0, 0}, 2};
+    satellites.parent[1] = satellites.appendName(std::make_shared<const std::string>("parent"));
+    satellites.parent[0] = 1;
+
+    EXPECT_EQ(satellites.getName(1), "parent");
+    EXPECT_THROW(satellites.getName(0), std::out_of_range);
+    EXPECT_THROW(satellites.getAoS(), std::out_of_range);
+}
@@ -0,0 +1,375 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <map>
+#include <optional>
+#include "breakupModel/output/ArrowWriter.h"
+
+class ArrowWriterTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        _satellites = Satellites{24946, SatType::DEBRIS, {1.0, 2.0, 3.0}, 5};
+        _satellites.nameTable = {std::make_shared<const std::string>("Iridium 33-Collision-Fragment"),
+                                 std::make_shared<const std::string>("Kosmos 2251-Collision-Fragment")};
+        for (size_t i = 0; i < _satellites.size(); ++i) {
+            const auto d = static_cast<double>(i + 1);
+            _satellites.parent[i] = static_cast<std::uint8_t>(i % 2);
+            _satellites.characteristicLength[i] = 0.1 * d;
+            _satellites.areaToMassRatio[i] = 0.01 * d;
+            _satellites.mass[i] = 10.0 * d;
+            _satellites.area[i] = 0.5 * d;
+            _satellites.ejectionVelocity[i] = {d, 2.0 * d, 3.0 * d};
+            _satellites.velocity[i] = {7000.0 + d, -d, 0.5 * d};
+        }
+    }
+
+    virtual void TearDown() {
+        try {
+            std::filesystem::remove(_filePath);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    std::string readFile() const {
+        std::ifstream file{_filePath, std::ios::binary};
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return stream.str();
+    }
+
+    template<typename T>
+    static T read(const std::string &content, size_t position) {
+        EXPECT_LE(position + sizeof(T), content.size());
+        T value;
+        std::memcpy(&value, content.data() + position, sizeof(T));
+        return value;
+    }
+
+    /**
+     * Returns the number of elements of the vector field with the given id of the root table of a FlatBuffer.
+     */
+    static std::uint32_t vectorLength(const std::string &content, size_t flatBuffer, size_t fieldId) {
+        const size_t table = flatBuffer + read<std::uint32_t>(content, flatBuffer);
+        const size_t vtable = table - read<std::int32_t>(content, table);
+        const size_t field = table + read<std::uint16_t>(content, vtable + 4 + 2 * fieldId);
+        return read<std::uint32_t>(content, field + read<std::uint32_t>(content, field));
+    }
+
+    /**
+     * Returns the position of the footer FlatBuffer.
+     */
+    static size_t footer(const std::string &content) {
+        return content.size() - 10 - read<std::int32_t>(content, content.size() - 10);
+    }
+
+    /**
+     * Read access to a table of a FlatBuffer, the fields are identified by their id in the schema files of Arrow
+     * (Schema.fbs, Message.fbs and File.fbs).
+     */
+    struct FlatTable {
+
+        const std::string *content;
+
+        size_t position;
+
+        static FlatTable root(const std::string &content, size_t flatBuffer) {
+            return FlatTable{&content, flatBuffer + read<std::uint32_t>(content, flatBuffer)};
+        }
+
+        std::optional<size_t> field(size_t id) const {
+            const size_t vtable = position - read<std::int32_t>(*content, position);
+            if (4 + 2 * id >= read<std::uint16_t>(*content, vtable)) {
+                return std::nullopt;
+            }
+            const std::uint16_t offset = read<std::uint16_t>(*content, vtable + 4 + 2 * id);
+            return offset == 0 ? std::nullopt : std::make_optional(position + offset);
+        }
+
+        template<typename T>
+        T scalar(size_t id, T defaultValue = T{}) const {
+            const auto position = field(id);
+            return position.has_value() ? read<T>(*content, *position) : defaultValue;
+        }
+
+        static size_t dereference(const std::string &content, size_t position) {
+            return position + read<std::uint32_t>(content, position);
+        }
+
+        FlatTable table(size_t id) const {
+            return FlatTable{content, dereference(*content, field(id).value())};
+        }
+
+        std::string string(size_t id) const {
+            const size_t string = dereference(*content, field(id).value());
+            return content->substr(string + 4, read<std::uint32_t>(*content, string));
+        }
+
+        size_t length(size_t id) const {
+            const auto position = field(id);
+            return position.has_value() ? read<std::uint32_t>(*content, dereference(*content, *position)) : 0;
+        }
+
+        FlatTable tableAt(size_t id, size_t index) const {
+            const size_t element = dereference(*content, field(id).value()) + 4 + 4 * index;
+            return FlatTable{content, dereference(*content, element)};
+        }
+
+        template<typename T>
+        T structAt(size_t id, size_t index) const {
+            return read<T>(*content, dereference(*content, field(id).value()) + 4 + sizeof(T) * index);
+        }
+
+    };
+
+    struct Block {
+        std::int64_t offset;
+        std::int32_t metaDataLength;
+        std::int32_t padding;
+        std::int64_t bodyLength;
+    };
+
+    struct Buffer {
+        std::int64_t offset;
+        std::int64_t length;
+    };
+
+    /**
+     * The content of an Arrow file with the columns of the ArrowWriter, decoded via the footer.
+     */
+    struct Decoded {
+        std::vector<std::string> fieldNames{};
+        std::map<std::string, std::string> metadata{};
+        std::vector<std::string> names{};
+        size_t length{0};
+        std::vector<std::uint64_t> id{};
+        std::vector<std::uint8_t> parent{};
+        std::vector<double> characteristicLength{};
+        std::vector<double> areaToMassRatio{};
+        std::vector<double> mass{};
+        std::vector<double> area{};
+        std::vector<std::array<double, 3>> ejectionVelocity{};
+        std::vector<std::array<double, 3>> velocity{};
+    };
+
+    template<typename T>
+    static void appendBuffer(std::vector<T> &column, const std::string &content, size_t body, const Buffer &buffer) {
+        const size_t start = column.size();
+        column.resize(start + buffer.length / sizeof(T));
+        std::memcpy(column.data() + start, content.data() + body + buffer.offset, buffer.length);
+    }
+
+    /**
+     * Decodes the file and checks the schema against the one the ArrowWriter is supposed to write.
+     */
+    static Decoded decode(const std::string &content) {
+        Decoded decoded{};
+        const FlatTable fileFooter = FlatTable::root(content, footer(content));
+        EXPECT_EQ(fileFooter.scalar<std::int16_t>(0), 4);
+
+        //Schema: endianness, fields, custom_metadata
+        const FlatTable schema = fileFooter.table(1);
+        EXPECT_EQ(schema.scalar<std::int16_t>(0), 0);
+        const std::vector<std::uint8_t> expectedTypes{2, 5, 3, 3, 3, 3, 16, 16};
+        EXPECT_EQ(schema.length(1), expectedTypes.size());
+        for (size_t i = 0; i < schema.length(1); ++i) {
+            //Field: name, nullable, type_type, type, dictionary, children
+            const FlatTable field = schema.tableAt(1, i);
+            decoded.fieldNames.push_back(field.string(0));
+            EXPECT_FALSE(field.scalar<bool>(1));
+            EXPECT_EQ(field.scalar<std::uint8_t>(2), expectedTypes[i]) << decoded.fieldNames.back();
+            if (expectedTypes[i] == 3) {
+                EXPECT_EQ(field.table(3).scalar<std::int16_t>(0), 2);
+            } else if (expectedTypes[i] == 16) {
+                EXPECT_EQ(field.table(3).scalar<std::int32_t>(0), 3);
+                EXPECT_EQ(field.length(5), 1);
+                if (field.length(5) == 1) {
+                    EXPECT_EQ(field.tableAt(5, 0).scalar<std::uint8_t>(2), 3);
+                }
+            }
+        }
+        //The name column: DictionaryEncoding with id 0 and uint8 indices
+        const FlatTable dictionary = schema.tableAt(1, 1).table(4);
+        EXPECT_EQ(dictionary.scalar<std::int64_t>(0), 0);
+        EXPECT_EQ(dictionary.table(1).scalar<std::int32_t>(0), 8);
+        EXPECT_FALSE(dictionary.table(1).scalar<bool>(1));
+        for (size_t i = 0; i < schema.length(2); ++i) {
+            decoded.metadata[schema.tableAt(2, i).string(0)] = schema.tableAt(2, i).string(1);
+        }
+
+        //Message: version, header_type, header, bodyLength
+        auto message = [&](const Block &block, std::uint8_t headerType) {
+            EXPECT_EQ(read<std::uint32_t>(content, block.offset), 0xFFFFFFFF);
+            const FlatTable message = FlatTable::root(content, block.offset + 8);
+            EXPECT_EQ(message.scalar<std::uint8_t>(1), headerType);
+            EXPECT_EQ(message.scalar<std::int64_t>(3), block.bodyLength);
+            return message.table(2);
+        };
+
+        //DictionaryBatch: id, data (RecordBatch: length, nodes, buffers)
+        EXPECT_EQ(fileFooter.length(2), 1);
+        for (size_t i = 0; i < fileFooter.length(2); ++i) {
+            const auto block = fileFooter.structAt<Block>(2, i);
+            const size_t body = block.offset + block.metaDataLength;
+            const FlatTable batch = message(block, 2).table(1);
+            std::vector<std::int32_t> offsets{};
+            appendBuffer(offsets, content, body, batch.structAt<Buffer>(2, 1));
+            const size_t characters = body + batch.structAt<Buffer>(2, 2).offset;
+            const auto nameCount = static_cast<size_t>(batch.scalar<std::int64_t>(0));
+            for (size_t name = 0; name < nameCount; ++name) {
+                decoded.names.push_back(content.substr(characters + offsets[name],
+                                                       offsets[name + 1] - offsets[name]));
+            }
+        }
+
+        for (size_t i = 0; i < fileFooter.length(3); ++i) {
+            const auto block = fileFooter.structAt<Block>(3, i);
+            const size_t body = block.offset + block.metaDataLength;
+            const FlatTable batch = message(block, 3);
+            decoded.length += batch.scalar<std::int64_t>(0);
+            EXPECT_EQ(batch.length(1), 10);
+            EXPECT_EQ(batch.length(2), 18);
+            auto buffer = [&](size_t index) { return batch.structAt<Buffer>(2, index); };
+            appendBuffer(decoded.id, content, body, buffer(1));
+            appendBuffer(decoded.parent, content, body, buffer(3));
+            appendBuffer(decoded.characteristicLength, content, body, buffer(5));
+            appendBuffer(decoded.areaToMassRatio, content, body, buffer(7));
+            appendBuffer(decoded.mass, content, body, buffer(9));
+            appendBuffer(decoded.area, content, body, buffer(11));
+            appendBuffer(decoded.ejectionVelocity, content, body, buffer(14));
+            appendBuffer(decoded.velocity, content, body, buffer(17));
+        }
+        return decoded;
+    }
+
+    /**
+     * Expects that the decoded columns equal the Satellites.
+     */
+    static void expectEqual(const Decoded &decoded, const Satellites &satellites) {
+        ASSERT_EQ(decoded.length, satellites.size());
+        ASSERT_EQ(decoded.names.size(), satellites.nameTable.size());
+        for (size_t i = 0; i < decoded.names.size(); ++i) {
+            EXPECT_EQ(decoded.names[i], *satellites.nameTable[i]);
+        }
+        ASSERT_EQ(decoded.id.size(), satellites.size());
+        for (size_t i = 0; i < satellites.size(); ++i) {
+            EXPECT_EQ(decoded.id[i], satellites.startId + i);
+            EXPECT_EQ(decoded.parent[i], satellites.parent[i]);
+            EXPECT_EQ(decoded.characteristicLength[i], satellites.characteristicLength[i]);
+            EXPECT_EQ(decoded.areaToMassRatio[i], satellites.areaToMassRatio[i]);
+            EXPECT_EQ(decoded.mass[i], satellites.mass[i]);
+            EXPECT_EQ(decoded.area[i], satellites.area[i]);
+            EXPECT_EQ(decoded.ejectionVelocity[i], satellites.ejectionVelocity[i]);
+            EXPECT_EQ(decoded.velocity[i], satellites.velocity[i]);
+        }
+    }
+
+    const std::string _filePath{"resources/arrowWriterTestFile.arrow"};
+
+    Satellites _satellites;
+
+};
+
+TEST_F(ArrowWriterTest, FileLayout) {
+    ArrowWriter{_filePath}.printResult(_satellites);
+    const std::string content = readFile();
+
+    ASSERT_EQ(content.substr(0, 8), std::string("ARROW1\0\0", 8));
+    ASSERT_EQ(content.substr(content.size() - 6), "ARROW1");
+    //The schema message follows the magic
+    ASSERT_EQ(read<std::uint32_t>(content, 8), 0xFFFFFFFF);
+
+    //One dictionary batch (the names) and one record batch
+    const size_t footerPosition = footer(content);
+    EXPECT_EQ(footerPosition % 8, 0);
+    EXPECT_EQ(vectorLength(content, footerPosition, 2), 1);
+    EXPECT_EQ(vectorLength(content, footerPosition, 3), 1);
+
+    //The columns are copied as they are into aligned buffers
+    const std::string mass{reinterpret_cast<const char *>(_satellites.mass.data()), 5 * sizeof(double)};
+    const size_t massPosition = content.find(mass);
+    ASSERT_NE(massPosition, std::string::npos);
+    EXPECT_EQ(massPosition % 64, 0);
+    EXPECT_NE(content.find(*_satellites.nameTable[1]), std::string::npos);
+}
+
+TEST_F(ArrowWriterTest, StreamingWritesOneRecordBatchPerBlock) {
+    {
+        ArrowWriter arrowWriter{_filePath};
+        arrowWriter.consume(_satellites);
+        _satellites.startId += _satellites.size();
+        arrowWriter.consume(_satellites);
+        arrowWriter.finish();
+    }
+    const std::string content = readFile();
+
+    const size_t footerPosition = footer(content);
+    EXPECT_EQ(vectorLength(content, footerPosition, 2), 1);
+    EXPECT_EQ(vectorLength(content, footerPosition, 3), 2);
+
+    //The IDs are continued in the second block
+    const std::uint64_t lastId = _satellites.startId + _satellites.size() - 1;
+    EXPECT_NE(content.find(std::string{reinterpret_cast<const char *>(&lastId), sizeof(std::uint64_t)}),
+              std::string::npos);
+}
+
+TEST_F(ArrowWriterTest, StreamingWithDifferentNamesThrows) {
+    ArrowWriter arrowWriter{_filePath};
+    arrowWriter.consume(_satellites);
+    _satellites.nameTable = {std::make_shared<const std::string>("Other-Fragment")};
+    EXPECT_THROW(arrowWriter.consume(_satellites), std::runtime_error);
+}
+
+TEST_F(ArrowWriterTest, DecodedSchemaAndRecordBatchEqualSatellites) {
+    ArrowWriter{_filePath}.printResult(_satellites);
+    const Decoded decoded = decode(readFile());
+
+    const std::vector<std::string> expectedFieldNames{"id", "name", "characteristicLength", "areaToMassRatio",
+                                                      "mass", "area", "ejectionVelocity", "velocity"};
+    EXPECT_EQ(decoded.fieldNames, expectedFieldNames);
+    EXPECT_EQ(decoded.metadata.at("satType"), "DEBRIS");
+    EXPECT_EQ(decoded.metadata.at("position"), "[1 2 3]");
+    expectEqual(decoded, _satellites);
+}
+
+/**
+ * The reference file was written by pyarrow (test/resources/ArrowWriterReference.py) from the same table as the
+ * fixture, so the decoding (and with it the layout written by the ArrowWriter) follows the Arrow implementation.
+ */
+TEST_F(ArrowWriterTest, ReferenceFileIsDecodedEqually) {
+    std::ifstream file{"resources/ArrowWriterReference.arrow", std::ios::binary};
+    ASSERT_TRUE(file.is_open());
+    std::stringstream stream;
+    stream << file.rdbuf();
+    const Decoded reference = decode(stream.str());
+
+    ArrowWriter{_filePath}.printResult(_satellites);
+    const Decoded decoded = decode(readFile());
+    EXPECT_EQ(decoded.fieldNames, reference.fieldNames);
+    EXPECT_EQ(decoded.metadata, reference.metadata);
+    expectEqual(reference, _satellites);
+}
+
+TEST_F(ArrowWriterTest, StreamingWithoutBlocksWritesEmptyTable) {
+    {
+        ArrowWriter arrowWriter{_filePath};
+        arrowWriter.finish();
+    }
+    const std::string content = readFile();
+    ASSERT_EQ(content.substr(0, 8), std::string("ARROW1\0\0", 8));
+    ASSERT_EQ(content.substr(content.size() - 6), "ARROW1");
+
+    const Decoded decoded = decode(content);
+    EXPECT_EQ(decoded.fieldNames.size(), 8);
+    EXPECT_EQ(decoded.length, 0);
+    EXPECT_TRUE(decoded.names.empty());
+}
@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <charconv>
+#include "breakupModel/output/BufferedTextOutput.h"
+#include "breakupModel/util/UtilityFormat.h"
+
+class BufferedTextOutputTest : public ::testing::Test {
+
+protected:
+
+    virtual void TearDown() {
+        try {
+            std::filesystem::remove(_filePath);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    const std::string _filePath{"resources/bufferedTextOutputTestFile.txt"};
+
+};
+
+TEST_F(BufferedTextOutputTest, LinesKeepTheirOrder) {
+    //More rows than one wave of chunks to cover the overlapping formatting and writing
+    const size_t rowCount = 100 * BufferedTextOutput::CHUNK_SIZE + 17;
+    {
+        BufferedTextOutput output{_filePath};
+        output.write("Header\n");
+        output.writeLines(rowCount, [](std::string &line, size_t row) {
+            util::appendNumber(line, row);
+            line.push_back(',');
+            util::appendNumber(line, static_cast<double>(row) / 3.0);
+        });
+    }
+
+    std::ifstream file{_filePath};
+    std::string line;
+    ASSERT_TRUE(std::getline(file, line));
+    ASSERT_EQ(line, "Header");
+    size_t expectedRow = 0;
+    while (std::getline(file, line)) {
+        const size_t comma = line.find(',');
+        size_t row{};
+        double value{};
+        std::from_chars(line.data(), line.data() + comma, row);
+        std::from_chars(line.data() + comma + 1, line.data() + line.size(), value);
+        ASSERT_EQ(row, expectedRow);
+        //The shortest representation reads back to exactly the same value
+        ASSERT_EQ(value, static_cast<double>(expectedRow) / 3.0) << "Row " << row;
+        ++expectedRow;
+    }
+    ASSERT_EQ(expectedRow, rowCount);
+}
+
+TEST_F(BufferedTextOutputTest, ArrayFormat) {
+    std::string line{};
+    util::appendArray(line, std::array<double, 3>{1.0, -2.5, 0.1});
+    ASSERT_EQ(line, "[1 -2.5 0.1]");
+}
@@ -2,7 +2,12 @@
 
 #include <filesystem>
 #include <vector>
+#include <memory>
+#include <fstream>
+#include <sstream>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "spdlog/sinks/basic_file_sink.h"
 #include "breakupModel/output/CSVPatternWriter.h"
 #include "breakupModel/input/CSVReader.h"
 
@@ -120,4 +125,42 @@ TEST_F(CSVPatternWriterTest, DataCheck) {
 
         ++line;
     }
-}
\ No newline at end of file
+}
+
+TEST_F(CSVPatternWriterTest, SoAEqualsAoS) {
+    Satellites satellites{24, SatType::DEBRIS, {7000000.0, 100.0, 0.0}, 4};
+    satellites.nameTable = {std::make_shared<const std::string>("Parent A"),
+                            std::make_shared<const std::string>("Parent B")};
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        const auto d = static_cast<double>(i + 1);
+        satellites.parent[i] = i % 2;
+        satellites.characteristicLength[i] = 0.1 * d;
+        satellites.areaToMassRatio[i] = 0.01 * d;
+        satellites.area[i] = d;
+        satellites.mass[i] = 100.0 / d;
+        satellites.ejectionVelocity[i] = {d, 2.0 * d, 3.0 * d};
+        satellites.velocity[i] = {10.0 * d, 7500.0 + d, 1000.0 - d};
+    }
+    const std::string soaFilePath{"resources/csvPatternTestFileSoA.csv"};
+    {
+        auto aosLogger = spdlog::basic_logger_mt("CSVPatternWriterTestAoS", _filePath, true);
+        auto soaLogger = spdlog::basic_logger_mt("CSVPatternWriterTestSoA", soaFilePath, true);
+        CSVPatternWriter aosWriter{aosLogger, "IntLRAmjvpaeiWwMET"};
+        CSVPatternWriter soaWriter{soaLogger, "IntLRAmjvpaeiWwMET"};
+        aosWriter.printResult(satellites.getAoS());
+        soaWriter.printResult(satellites);
+        aosLogger->flush();
+        soaLogger->flush();
+    }
+
+    std::ifstream aosFile{_filePath};
+    std::ifstream soaFile{soaFilePath};
+    std::stringstream aosContent;
+    std::stringstream soaContent;
+    aosContent << aosFile.rdbuf();
+    soaContent << soaFile.rdbuf();
+    std::filesystem::remove(soaFilePath);
+
+    ASSERT_FALSE(aosContent.str().empty());
+    ASSERT_EQ(soaContent.str(), aosContent.str());
+}
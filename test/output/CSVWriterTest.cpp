@@ -1,11 +1,16 @@
 #include "gtest/gtest.h"
 
 #include <vector>
+#include <memory>
+#include <fstream>
+#include <sstream>
 #include <string>
 #include <filesystem>
+#include "spdlog/sinks/basic_file_sink.h"
 #include "breakupModel/output/CSVWriter.h"
 #include "breakupModel/input/CSVReader.h"
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
 
 class CSVWriterTest : public ::testing::Test {
 
@@ -123,3 +128,43 @@ TEST_F(CSVWriterTest, DataCheck) {
         ++line;
     }
 }
+
+TEST_F(CSVWriterTest, SoAEqualsAoS) {
+    Satellites satellites{24, SatType::DEBRIS, {7000000.0, 100.0, 0.0}, 4};
+    satellites.nameTable = {std::make_shared<const std::string>("Parent A"),
+                            std::make_shared<const std::string>("Parent B")};
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        const auto d = static_cast<double>(i + 1);
+        satellites.parent[i] = i % 2;
+        satellites.characteristicLength[i] = 0.1 * d;
+        satellites.areaToMassRatio[i] = 0.01 * d;
+        satellites.area[i] = d;
+        satellites.mass[i] = 100.0 / d;
+        satellites.ejectionVelocity[i] = {d, 2.0 * d, 3.0 * d};
+        satellites.velocity[i] = {10.0 * d, 7500.0 + d, 1000.0 - d};
+    }
+    const std::string soaFilePath{"resources/csvTestFileSoA.csv"};
+    for (bool withKepler : {false, true}) {
+        {
+            auto aosLogger = spdlog::basic_logger_mt("CSVWriterTestAoS", _filePath, true);
+            auto soaLogger = spdlog::basic_logger_mt("CSVWriterTestSoA", soaFilePath, true);
+            CSVWriter aosWriter{aosLogger, withKepler};
+            CSVWriter soaWriter{soaLogger, withKepler};
+            aosWriter.printResult(satellites.getAoS());
+            soaWriter.printResult(satellites);
+            aosLogger->flush();
+            soaLogger->flush();
+        }
+
+        std::ifstream aosFile{_filePath};
+        std::ifstream soaFile{soaFilePath};
+        std::stringstream aosContent;
+        std::stringstream soaContent;
+        aosContent << aosFile.rdbuf();
+        soaContent << soaFile.rdbuf();
+
+        ASSERT_FALSE(aosContent.str().empty());
+        ASSERT_EQ(soaContent.str(), aosContent.str()) << "Kepler: " << withKepler;
+    }
+    std::filesystem::remove(soaFilePath);
+}
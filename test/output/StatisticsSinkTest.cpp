@@ -0,0 +1,26 @@
+#include "gtest/gtest.h"
+
+#include "breakupModel/output/StatisticsSink.h"
+
+TEST(StatisticsSinkTest, SummaryOverBlocks) {
+    StatisticsSink sink{};
+
+    Satellites first{1, SatType::DEBRIS, {0, 0, 0}, 2};
+    first.characteristicLength = {0.1, 0.5};
+    first.mass = {1.0, 2.0};
+    first.ejectionVelocity = {{{3.0, 4.0, 0.0}}, {{0.0, 0.0, 1.0}}};
+    Satellites second{3, SatType::DEBRIS, {0, 0, 0}, 1};
+    second.characteristicLength = {0.05};
+    second.mass = {0.5};
+    second.ejectionVelocity = {{{0.0, 3.0, 0.0}}};
+
+    sink.consume(first);
+    sink.consume(second);
+    sink.finish();
+
+    ASSERT_EQ(sink.getCount(), 3);
+    ASSERT_DOUBLE_EQ(sink.getMass(), 3.5);
+    ASSERT_DOUBLE_EQ(sink.getMinCharacteristicLength(), 0.05);
+    ASSERT_DOUBLE_EQ(sink.getMaxCharacteristicLength(), 0.5);
+    ASSERT_DOUBLE_EQ(sink.getMeanEjectionVelocity(), 3.0);
+}
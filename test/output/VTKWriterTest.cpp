@@ -1,10 +1,16 @@
 #include "gtest/gtest.h"
 
 #include <vector>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <fstream>
 #include <filesystem>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "spdlog/sinks/basic_file_sink.h"
 #include "breakupModel/output/VTKWriter.h"
 
 class VTKWriterTest : public ::testing::Test {
@@ -68,4 +74,254 @@ TEST_F(VTKWriterTest, DataCheck) {
         actualLineNumber += 1;
     }
     ASSERT_EQ(actualLineNumber, 58);
-}
\ No newline at end of file
+}
+
+TEST_F(VTKWriterTest, SoAEqualsAoS) {
+    Satellites satellites{24, SatType::DEBRIS, {7000000.0, 100.0, 0.0}, 4};
+    satellites.nameTable = {std::make_shared<const std::string>("Parent A"),
+                            std::make_shared<const std::string>("Parent B")};
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        const auto d = static_cast<double>(i + 1);
+        satellites.parent[i] = i % 2;
+        satellites.characteristicLength[i] = 0.1 * d;
+        satellites.areaToMassRatio[i] = 0.01 * d;
+        satellites.area[i] = d;
+        satellites.mass[i] = 100.0 / d;
+        satellites.ejectionVelocity[i] = {d, 2.0 * d, 3.0 * d};
+        satellites.velocity[i] = {10.0 * d, 7500.0 + d, 1000.0 - d};
+    }
+    const std::string soaFilePath{"resources/VTKWriterTestSoA.vtu"};
+    {
+        auto aosLogger = spdlog::basic_logger_mt("VTKWriterTestAoS", _filePath, true);
+        auto soaLogger = spdlog::basic_logger_mt("VTKWriterTestSoA", soaFilePath, true);
+        VTKWriter aosWriter{aosLogger};
+        VTKWriter soaWriter{soaLogger};
+        aosWriter.printResult(satellites.getAoS());
+        soaWriter.printResult(satellites);
+        aosLogger->flush();
+        soaLogger->flush();
+    }
+
+    std::ifstream aosFile{_filePath};
+    std::ifstream soaFile{soaFilePath};
+    std::stringstream aosContent;
+    std::stringstream soaContent;
+    aosContent << aosFile.rdbuf();
+    soaContent << soaFile.rdbuf();
+    std::filesystem::remove(soaFilePath);
+
+    ASSERT_FALSE(aosContent.str().empty());
+    ASSERT_EQ(soaContent.str(), aosContent.str());
+}
+
+namespace {
+
+    /**
+     * Decodes base64 (RFC 4648) without padding validation.
+     */
+    std::string decodeBase64(const std::string &encoded) {
+        const std::string alphabet{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+        std::string decoded{};
+        unsigned int group = 0;
+        int bits = 0;
+        for (char c : encoded) {
+            const size_t value = alphabet.find(c);
+            if (value == std::string::npos) {
+                continue;
+            }
+            group = (group << 6u) | static_cast<unsigned int>(value);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                decoded.push_back(static_cast<char>((group >> static_cast<unsigned int>(bits)) & 0xFFu));
+            }
+        }
+        return decoded;
+    }
+
+    Satellites createSatellites() {
+        Satellites satellites{1, SatType::DEBRIS, {1.0, 2.0, 3.0}, 4};
+        satellites.nameTable = {std::make_shared<const std::string>("Parent")};
+        for (size_t i = 0; i < satellites.size(); ++i) {
+            const auto d = static_cast<double>(i + 1);
+            satellites.characteristicLength[i] = 0.1 * d;
+            satellites.mass[i] = 10.0 * d;
+            satellites.velocity[i] = {d, -d, 0.5 * d};
+        }
+        return satellites;
+    }
+
+}
+
+TEST_F(VTKWriterTest, AppendedData) {
+    const Satellites satellites = createSatellites();
+    {
+        VTKWriter vtkWriter{_filePath, VTKFormat::APPENDED};
+        vtkWriter.printResult(satellites);
+    }
+
+    std::ifstream file{_filePath, std::ios::binary};
+    std::stringstream stream;
+    stream << file.rdbuf();
+    const std::string content = stream.str();
+
+    ASSERT_NE(content.find(R"(header_type="UInt64")"), std::string::npos);
+    ASSERT_NE(content.find(R"(<DataArray Name="mass" NumberOfComponents="1" format="appended" offset="40" type="Float64"/>)"),
+              std::string::npos);
+    const size_t dataBegin = content.find("<AppendedData encoding=\"raw\">");
+    ASSERT_NE(dataBegin, std::string::npos);
+    const char *appended = content.data() + content.find('_', dataBegin) + 1;
+
+    //Block 0: characteristic length | Block 1: mass | ... | Block 6: position
+    std::uint64_t byteCount{};
+    std::memcpy(&byteCount, appended, sizeof(std::uint64_t));
+    ASSERT_EQ(byteCount, 4 * sizeof(double));
+    std::vector<double> values(4);
+    std::memcpy(values.data(), appended + sizeof(std::uint64_t), byteCount);
+    ASSERT_EQ(values, satellites.characteristicLength);
+    std::memcpy(values.data(), appended + 40 + sizeof(std::uint64_t), byteCount);
+    ASSERT_EQ(values, satellites.mass);
+
+    const size_t positionOffset = 4 * 40 + 2 * (sizeof(std::uint64_t) + 12 * sizeof(double));
+    std::memcpy(&byteCount, appended + positionOffset, sizeof(std::uint64_t));
+    ASSERT_EQ(byteCount, 12 * sizeof(double));
+    std::vector<double> positions(12);
+    std::memcpy(positions.data(), appended + positionOffset + sizeof(std::uint64_t), byteCount);
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(positions[3 * i], 1.0);
+        ASSERT_EQ(positions[3 * i + 1], 2.0);
+        ASSERT_EQ(positions[3 * i + 2], 3.0);
+    }
+    ASSERT_NE(content.find("</AppendedData>\n</VTKFile>"), std::string::npos);
+}
+
+TEST_F(VTKWriterTest, Base64Data) {
+    const Satellites satellites = createSatellites();
+    {
+        auto vtkTestLogger = spdlog::basic_logger_mt("VTKWriterTest", _filePath, true);
+        VTKWriter vtkWriter{vtkTestLogger, VTKFormat::BASE64};
+        vtkWriter.printResult(satellites);
+    }
+
+    std::ifstream file{_filePath};
+    std::string line;
+    while (std::getline(file, line) && line.find(R"(Name="velocity")") == std::string::npos) {}
+    ASSERT_NE(line.find(R"(format="binary" type="Float64")"), std::string::npos);
+    ASSERT_TRUE(std::getline(file, line));
+
+    const std::string decoded = decodeBase64(line);
+    std::uint64_t byteCount{};
+    ASSERT_EQ(decoded.size(), sizeof(std::uint64_t) + 12 * sizeof(double));
+    std::memcpy(&byteCount, decoded.data(), sizeof(std::uint64_t));
+    ASSERT_EQ(byteCount, 12 * sizeof(double));
+    std::vector<std::array<double, 3>> velocity(4);
+    std::memcpy(velocity.data(), decoded.data() + sizeof(std::uint64_t), byteCount);
+    ASSERT_EQ(velocity, satellites.velocity);
+}
+
+TEST_F(VTKWriterTest, PartitionedOutput) {
+    const Satellites satellites = createSatellites();
+    const std::string stem{"resources/VTKWriterTestPartitioned"};
+    for (size_t pieceCount : {3, 10}) {
+        {
+            VTKWriter vtkWriter{stem + ".vtu", VTKFormat::APPENDED, pieceCount};
+            vtkWriter.printResult(satellites);
+        }
+        //There are never more pieces than points
+        const size_t expectedPieces = std::min<size_t>(pieceCount, satellites.size());
+
+        std::ifstream index{stem + ".pvtu"};
+        std::stringstream indexContent;
+        indexContent << index.rdbuf();
+        ASSERT_NE(indexContent.str().find(R"(type="PUnstructuredGrid")"), std::string::npos);
+        ASSERT_NE(indexContent.str().find("<PPoints>\n      <PDataArray Name=\"position\" NumberOfComponents=\"3\""),
+                  std::string::npos);
+        size_t totalPoints = 0;
+        for (size_t piece = 0; piece < expectedPieces; ++piece) {
+            const std::string pieceFile = stem + "_" + std::to_string(piece) + ".vtu";
+            ASSERT_NE(indexContent.str().find("<Piece Source=\"VTKWriterTestPartitioned_" + std::to_string(piece)
+                                              + ".vtu\"/>"), std::string::npos) << "Piece " << piece;
+            std::ifstream pieceStream{pieceFile, std::ios::binary};
+            std::string line;
+            while (std::getline(pieceStream, line) && line.find("NumberOfPoints") == std::string::npos) {}
+            const size_t begin = line.find("NumberOfPoints=\"") + 16;
+            totalPoints += std::stoul(line.substr(begin, line.find('"', begin) - begin));
+            pieceStream.close();
+            std::filesystem::remove(pieceFile);
+        }
+        ASSERT_EQ(indexContent.str().find("<Piece Source=\"VTKWriterTestPartitioned_" + std::to_string(expectedPieces)),
+                  std::string::npos);
+        ASSERT_EQ(totalPoints, satellites.size());
+        std::filesystem::remove(stem + ".pvtu");
+    }
+}
+
+TEST_F(VTKWriterTest, PartitionedStreaming) {
+    const Satellites satellites = createSatellites();
+    const std::string stem{"resources/VTKWriterTestStreamed"};
+    {
+        VTKWriter vtkWriter{stem + ".vtu", VTKFormat::ASCII, 4};
+        vtkWriter.consume(satellites);
+        vtkWriter.consume(satellites);
+        vtkWriter.finish();
+    }
+
+    std::ifstream index{stem + ".pvtu"};
+    std::stringstream indexContent;
+    indexContent << index.rdbuf();
+    ASSERT_NE(indexContent.str().find(R"(<Piece Source="VTKWriterTestStreamed_1.vtu"/>)"), std::string::npos);
+    ASSERT_EQ(indexContent.str().find(R"(<Piece Source="VTKWriterTestStreamed_2.vtu"/>)"), std::string::npos);
+    for (size_t piece = 0; piece < 2; ++piece) {
+        ASSERT_TRUE(std::filesystem::exists(stem + "_" + std::to_string(piece) + ".vtu"));
+        std::filesystem::remove(stem + "_" + std::to_string(piece) + ".vtu");
+    }
+    std::filesystem::remove(stem + ".pvtu");
+}
+
+TEST_F(VTKWriterTest, ColumnsLargerThanAChunk) {
+    //More than two chunks of points, the last one incomplete and not a multiple of three bytes
+    Satellites satellites{1, SatType::DEBRIS, {1.0, 2.0, 3.0}, 2 * (1u << 16u) + 7};
+    satellites.nameTable = {std::make_shared<const std::string>("Parent")};
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        const auto d = static_cast<double>(i + 1);
+        satellites.mass[i] = 10.0 * d;
+        satellites.velocity[i] = {d, -d, 0.5 * d};
+    }
+    const std::string aosFilePath{"resources/VTKWriterTestChunkedAoS.vtu"};
+    {
+        VTKWriter soaWriter{_filePath, VTKFormat::BASE64};
+        VTKWriter aosWriter{aosFilePath, VTKFormat::BASE64};
+        soaWriter.printResult(satellites);
+        aosWriter.printResult(satellites.getAoS());
+    }
+    std::ifstream file{_filePath};
+    std::ifstream aosFile{aosFilePath};
+    std::stringstream content;
+    std::stringstream aosContent;
+    content << file.rdbuf();
+    aosContent << aosFile.rdbuf();
+    std::filesystem::remove(aosFilePath);
+    ASSERT_EQ(content.str(), aosContent.str());
+
+    //Returns the decoded data of a column after checking its size header
+    auto column = [&](const std::string &name, size_t components) {
+        const size_t tag = content.str().find("Name=\"" + name + "\"");
+        const size_t begin = content.str().find('\n', tag) + 1;
+        const std::string decoded = decodeBase64(content.str().substr(begin, content.str().find('\n', begin) - begin));
+        std::uint64_t byteCount{};
+        std::memcpy(&byteCount, decoded.data(), sizeof(std::uint64_t));
+        EXPECT_EQ(byteCount, satellites.size() * components * sizeof(double));
+        EXPECT_EQ(decoded.size(), sizeof(std::uint64_t) + byteCount);
+        std::vector<double> values(satellites.size() * components);
+        std::memcpy(values.data(), decoded.data() + sizeof(std::uint64_t), values.size() * sizeof(double));
+        return values;
+    };
+    ASSERT_EQ(column("mass", 1), satellites.mass);
+    const std::vector<double> velocity = column("velocity", 3);
+    const std::vector<double> position = column("position", 3);
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(velocity[3 * i + 1], satellites.velocity[i][1]) << i;
+        ASSERT_EQ(position[3 * i], 1.0) << i;
+        ASSERT_EQ(position[3 * i + 2], 3.0) << i;
+    }
+}
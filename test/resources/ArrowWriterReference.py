@@ -0,0 +1,32 @@
+# Writes ArrowWriterReference.arrow with pyarrow from the same table as the fixture of ArrowWriterTest
+# Usage: python3 ArrowWriterReference.py (requires pyarrow)
+import pyarrow as pa
+
+count = 5
+d = [float(i + 1) for i in range(count)]
+vector = pa.list_(pa.field("item", pa.float64(), nullable=False), 3)
+schema = pa.schema([
+    pa.field("id", pa.uint64(), nullable=False),
+    pa.field("name", pa.dictionary(pa.uint8(), pa.utf8()), nullable=False),
+    pa.field("characteristicLength", pa.float64(), nullable=False),
+    pa.field("areaToMassRatio", pa.float64(), nullable=False),
+    pa.field("mass", pa.float64(), nullable=False),
+    pa.field("area", pa.float64(), nullable=False),
+    pa.field("ejectionVelocity", vector, nullable=False),
+    pa.field("velocity", vector, nullable=False),
+], metadata={"satType": "DEBRIS", "position": "[1 2 3]"})
+names = pa.array(["Iridium 33-Collision-Fragment", "Kosmos 2251-Collision-Fragment"])
+table = pa.table([
+    pa.array([24946 + i for i in range(count)], pa.uint64()),
+    pa.DictionaryArray.from_arrays(pa.array([i % 2 for i in range(count)], pa.uint8()), names),
+    pa.array([0.1 * x for x in d]),
+    pa.array([0.01 * x for x in d]),
+    pa.array([10.0 * x for x in d]),
+    pa.array([0.5 * x for x in d]),
+    pa.array([[x, 2.0 * x, 3.0 * x] for x in d], vector),
+    pa.array([[7000.0 + x, -x, 0.5 * x] for x in d], vector),
+], schema=schema)
+
+with pa.OSFile("ArrowWriterReference.arrow", "wb") as sink:
+    with pa.ipc.new_file(sink, schema) as writer:
+        writer.write_table(table)
@@ -107,3 +107,13 @@ TEST_F(BreakupBuilderTest, ConfigCollisionFilter2) {
     ASSERT_EQ(breakup->getInput(), _satellites2);
     ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
 }
+
+TEST_F(BreakupBuilderTest, ExecutionMode) {
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, _satellites2);
+    BreakupBuilder breakupBuilder {config};
+
+    ASSERT_EQ(breakupBuilder.getBreakup()->getExecutionMode(), ExecutionMode::STAGED);
+    ASSERT_EQ(breakupBuilder.setExecutionMode(ExecutionMode::FUSED).getBreakup()->getExecutionMode(),
+              ExecutionMode::FUSED);
+}
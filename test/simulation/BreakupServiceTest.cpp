@@ -0,0 +1,170 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <sstream>
+#include <map>
+#include <array>
+#include <memory>
+#include <cstring>
+#include <thread>
+#include <chrono>
+#include <filesystem>
+#include "breakupModel/input/YAMLDataReader.h"
+#include "breakupModel/input/YAMLRequestReader.h"
+#include "breakupModel/model/SatelliteCatalog.h"
+#include "breakupModel/simulation/BreakupBuilder.h"
+#include "breakupModel/simulation/BreakupService.h"
+#include "breakupModel/output/CSVWriter.h"
+#include "breakupModel/util/UtilityBinary.h"
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#endif
+
+class BreakupServiceTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        _catalog = std::make_shared<const SatelliteCatalog>(
+                YAMLDataReader{"resources/YamlDataReaderTest01.yaml"}.getSatelliteCollection());
+    }
+
+    /**
+     * Splits the responses into <request ID, <header, content>>.
+     */
+    static std::map<std::string, std::pair<std::string, std::string>> parseResponses(const std::string &responses) {
+        std::map<std::string, std::pair<std::string, std::string>> parsed{};
+        size_t position = 0;
+        while (position < responses.size()) {
+            const size_t lineEnd = responses.find('\n', position);
+            const std::string header = responses.substr(position, lineEnd - position);
+            const size_t byteCount = std::stoul(header.substr(header.rfind(' ') + 1));
+            std::istringstream fields{header};
+            std::string kind{};
+            std::string requestID{};
+            fields >> kind >> requestID;
+            parsed[requestID] = std::make_pair(header, responses.substr(lineEnd + 1, byteCount));
+            position = lineEnd + 1 + byteCount;
+        }
+        return parsed;
+    }
+
+    std::shared_ptr<const SatelliteCatalog> _catalog;
+
+};
+
+TEST_F(BreakupServiceTest, ResponseEqualsDirectSimulation) {
+    const std::string request{"{id: 3, idFilter: [1, 2], minimalCharacteristicLength: 0.1, simulationType: CO, "
+                              "seed: 42}"};
+    BreakupService service{_catalog, 48514, 1};
+    const std::string response = service.handle(request, 0);
+
+    auto requestReader = std::make_shared<YAMLRequestReader>(request);
+    auto breakup = BreakupBuilder{requestReader, _catalog}.setCurrentMaximalGivenID(48514).getBreakup();
+    breakup->setSeed(42);
+    breakup->run();
+    std::ostringstream expectedContent{};
+    CSVWriter{expectedContent}.printResult(breakup->getResultSoA());
+
+    const std::string expectedHeader = "RESULT 3 csv " + std::to_string(breakup->getResultSoA().size()) + " "
+                                       + std::to_string(expectedContent.str().size()) + "\n";
+    EXPECT_EQ(response, expectedHeader + expectedContent.str());
+}
+
+TEST_F(BreakupServiceTest, ServeAnswersEveryRequest) {
+    std::istringstream requests{
+            "{idFilter: [1, 2], minimalCharacteristicLength: 0.1, simulationType: CO, seed: 1}\n"
+            "# A comment and an empty line are skipped\n"
+            "\n"
+            "{id: 10, idFilter: [3], minimalCharacteristicLength: 0.1, seed: 2, format: binary}\n"
+            "{idFilter: [1, 2, 3], minimalCharacteristicLength: 0.1}\n"
+            "{minimalCharacteristicLength: 0.1, satellites: [{id: 60000, mass: 500.0, velocity: [0, 0, 0]}]}\n"
+            "{id: 0, minimalCharacteristicLength: 0.1}\n"};
+    std::string responses{};
+    BreakupService service{_catalog, 48514, 3};
+    service.serve(requests, [&](const std::string &response) { responses += response; });
+
+    auto parsed = parseResponses(responses);
+    ASSERT_EQ(parsed.size(), 5);
+    EXPECT_EQ(parsed["#0"].first.substr(0, 14), "RESULT #0 csv ");
+    EXPECT_EQ(parsed["#0"].second.substr(0, 3), "ID,");
+
+    //The binary content can be stored as a file for the BinaryResultReader
+    EXPECT_EQ(parsed["10"].first.substr(0, 17), "RESULT 10 binary ");
+    EXPECT_EQ(std::memcmp(parsed["10"].second.data(), util::binary::MAGIC.data(), util::binary::MAGIC.size()), 0);
+
+    //Three satellites are neither an explosion nor a collision
+    EXPECT_EQ(parsed["#2"].first.substr(0, 9), "ERROR #2 ");
+    EXPECT_FALSE(parsed["#2"].second.empty());
+
+    //The fragment IDs of inline satellites continue after their own maximal ID
+    EXPECT_EQ(parsed["#3"].second.substr(parsed["#3"].second.find('\n') + 1, 6), "60001,");
+
+    //The given ID 0 is distinct from the first request, which has none, it selects no satellites at all
+    EXPECT_EQ(parsed["0"].first.substr(0, 8), "ERROR 0 ");
+    EXPECT_NE(parsed["0"].second.find("idFilter"), std::string::npos);
+}
+
+TEST_F(BreakupServiceTest, OutputErrorIsRethrown) {
+    std::istringstream requests{"{idFilter: [3], minimalCharacteristicLength: 0.1}\n"
+                                "{idFilter: [3], minimalCharacteristicLength: 0.1}\n"};
+    BreakupService service{_catalog, 48514, 2};
+    size_t calls = 0;
+    EXPECT_THROW(service.serve(requests, [&](const std::string &) {
+        ++calls;
+        throw std::runtime_error{"Connection closed"};
+    }), std::runtime_error);
+    //After the first failure no further response is written
+    EXPECT_EQ(calls, 1);
+}
+
+#ifndef _WIN32
+
+TEST_F(BreakupServiceTest, ListenStopsAndRemovesSocket) {
+    const std::string socketPath = (std::filesystem::temp_directory_path()
+                                    / ("BreakupServiceTest" + std::to_string(::getpid()) + ".sock")).string();
+    BreakupService service{_catalog, 48514, 1};
+    std::thread listener{[&]() { service.listen(socketPath); }};
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    //The listener binds the socket asynchronously
+    bool connected = false;
+    for (size_t attempt = 0; attempt < 500 && !connected; ++attempt) {
+        connected = ::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(sockaddr_un)) == 0;
+        if (!connected) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+    }
+    ASSERT_TRUE(connected);
+
+    const std::string request{"{id: 5, idFilter: [3], minimalCharacteristicLength: 0.1}\n"};
+    ASSERT_EQ(::write(fd, request.data(), request.size()), static_cast<ssize_t>(request.size()));
+    std::string response{};
+    std::array<char, 4096> buffer{};
+    while (response.find('\n') == std::string::npos) {
+        const ssize_t count = ::read(fd, buffer.data(), buffer.size());
+        ASSERT_GT(count, 0);
+        response.append(buffer.data(), static_cast<size_t>(count));
+    }
+    EXPECT_EQ(response.substr(0, 13), "RESULT 5 csv ");
+
+    //The connection is still open, the stop ends its input and listen returns
+    service.stop();
+    listener.join();
+    EXPECT_FALSE(std::filesystem::exists(socketPath));
+    ssize_t count;
+    while ((count = ::read(fd, buffer.data(), buffer.size())) > 0) {}
+    EXPECT_EQ(count, 0);
+    ::close(fd);
+}
+
+#endif
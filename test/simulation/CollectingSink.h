@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/output/FragmentSink.h"
+
+/**
+ * Test sink which collects all streamed fragments into one Satellites object.
+ */
+class CollectingSink : public FragmentSink {
+
+public:
+
+    Satellites fragments{};
+
+    size_t blockCount{0};
+
+    void consume(const Satellites &block) override {
+        blockCount += 1;
+        fragments.parent.insert(fragments.parent.end(), block.parent.begin(), block.parent.end());
+        fragments.characteristicLength.insert(fragments.characteristicLength.end(),
+                                              block.characteristicLength.begin(), block.characteristicLength.end());
+        fragments.areaToMassRatio.insert(fragments.areaToMassRatio.end(),
+                                         block.areaToMassRatio.begin(), block.areaToMassRatio.end());
+        fragments.mass.insert(fragments.mass.end(), block.mass.begin(), block.mass.end());
+        fragments.area.insert(fragments.area.end(), block.area.begin(), block.area.end());
+        fragments.ejectionVelocity.insert(fragments.ejectionVelocity.end(),
+                                          block.ejectionVelocity.begin(), block.ejectionVelocity.end());
+        fragments.velocity.insert(fragments.velocity.end(), block.velocity.begin(), block.velocity.end());
+        fragments.nameTable = block.nameTable;
+    }
+
+};
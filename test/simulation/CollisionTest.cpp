@@ -5,9 +5,11 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <numeric>
 #include "breakupModel/model/Satellite.h"
 #include "breakupModel/model/SatelliteBuilder.h"
 #include "breakupModel/simulation/Collision.h"
+#include "CollectingSink.h"
 
 class CollisionTest : public ::testing::Test {
 
@@ -117,4 +119,95 @@ TEST_F(CollisionTest, CheckNoRaceCondition) {
            "It could also be just a random coincidence of the RNG\n"
            "Rerun this in such a case!\n";
     }
-}
\ No newline at end of file
+}
+TEST_F(CollisionTest, FusedExecutionEqualsStagedExecution) {
+    _collision->setSeed(std::make_optional(1234)).setExecutionMode(ExecutionMode::STAGED).run();
+    auto stagedOutput = _collision->getResultSoA();
+    _collision->setSeed(std::make_optional(1234)).setExecutionMode(ExecutionMode::FUSED).run();
+    auto fusedOutput = _collision->getResultSoA();
+
+    ASSERT_EQ(stagedOutput.size(), fusedOutput.size());
+    ASSERT_EQ(stagedOutput.characteristicLength, fusedOutput.characteristicLength);
+    ASSERT_EQ(stagedOutput.areaToMassRatio, fusedOutput.areaToMassRatio);
+    ASSERT_EQ(stagedOutput.mass, fusedOutput.mass);
+    ASSERT_EQ(stagedOutput.ejectionVelocity, fusedOutput.ejectionVelocity);
+    ASSERT_EQ(stagedOutput.velocity, fusedOutput.velocity);
+}
+
+namespace {
+
+    /**
+     * Serial reference of the parent assignment: Fragments greater than the small satellite belong to the big
+     * satellite, the remaining fragments are assigned to the big satellite in order until its normed mass is reached.
+     * @return the parent index of every fragment (0: big satellite | 1: small satellite)
+     */
+    std::vector<std::uint8_t> serialParentAssignment(const Satellites &output, const Satellite &bigSat,
+                                                     const Satellite &smallSat) {
+        const double smallLc = smallSat.getCharacteristicLength();
+        const double outputMass = std::accumulate(output.mass.begin(), output.mass.end(), 0.0);
+        const double normedMassBigSat = bigSat.getMass() * outputMass / (bigSat.getMass() + smallSat.getMass());
+
+        std::vector<std::uint8_t> parent(output.size(), 1);
+        double assignedMass = 0.0;
+        for (size_t i = 0; i < output.size(); ++i) {
+            if (output.characteristicLength[i] > smallLc) {
+                parent[i] = 0;
+                assignedMass += output.mass[i];
+            }
+        }
+        for (size_t i = 0; i < output.size(); ++i) {
+            if (output.characteristicLength[i] <= smallLc) {
+                if (assignedMass >= normedMassBigSat) {
+                    break;
+                }
+                parent[i] = 0;
+                assignedMass += output.mass[i];
+            }
+        }
+        return parent;
+    }
+
+}
+
+TEST_F(CollisionTest, ParentAssignment) {
+    //The collision sorts its input so that the bigger satellite comes first
+    const Satellite bigSat = sat2;
+    const Satellite smallSat = sat1;
+    //The fragment counts span one to several blocks of the parallel parent assignment (256 fragments each)
+    for (double minimalCharacteristicLength : {0.05, 0.1, 0.2, 0.5}) {
+        Collision collision{_input, minimalCharacteristicLength};
+        for (std::uint64_t seed = 1; seed <= 10; ++seed) {
+            collision.setSeed(std::make_optional(seed)).run();
+            const Satellites &output = collision.getResultSoA();
+            ASSERT_EQ(output.nameTable.size(), 2);
+            ASSERT_EQ(*output.nameTable[0], bigSat.getName() + "-Collision-Fragment");
+            ASSERT_EQ(*output.nameTable[1], smallSat.getName() + "-Collision-Fragment");
+
+            const auto expectedParent = serialParentAssignment(output, bigSat, smallSat);
+            ASSERT_EQ(output.parent.size(), expectedParent.size());
+            for (size_t i = 0; i < output.size(); ++i) {
+                EXPECT_EQ(output.parent[i], expectedParent[i])
+                                    << "L_c " << minimalCharacteristicLength << " Seed " << seed << " Index " << i;
+            }
+        }
+    }
+}
+
+TEST_F(CollisionTest, StreamingEqualsRun) {
+    for (std::uint64_t seed = 1; seed <= 5; ++seed) {
+        _collision->setSeed(std::make_optional(seed)).run();
+        auto output = _collision->getResultSoA();
+
+        auto sink = std::make_shared<CollectingSink>();
+        _collision->setSeed(std::make_optional(seed)).runStreaming({sink}, 256);
+
+        ASSERT_EQ(sink->fragments.characteristicLength, output.characteristicLength) << "Seed " << seed;
+        ASSERT_EQ(sink->fragments.areaToMassRatio, output.areaToMassRatio) << "Seed " << seed;
+        ASSERT_EQ(sink->fragments.mass, output.mass) << "Seed " << seed;
+        ASSERT_EQ(sink->fragments.ejectionVelocity, output.ejectionVelocity) << "Seed " << seed;
+        ASSERT_EQ(sink->fragments.velocity, output.velocity) << "Seed " << seed;
+        for (size_t i = 0; i < output.size(); ++i) {
+            ASSERT_EQ(sink->fragments.getName(i), output.getName(i)) << "Seed " << seed << " Index " << i;
+        }
+    }
+}
@@ -0,0 +1,124 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <numeric>
+#include <memory>
+#include <optional>
+#include <limits>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/simulation/Ensemble.h"
+#include "breakupModel/simulation/EnsembleStatistics.h"
+#include "breakupModel/input/RuntimeInputSource.h"
+
+class EnsembleStatisticsTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        SatelliteBuilder satelliteBuilder{};
+        _input.push_back(satelliteBuilder
+                                 .setID(7946)
+                                 .setName("1975-052B")
+                                 .setSatType(SatType::ROCKET_BODY)
+                                 .setMass(839)
+                                 .setVelocity({0.0, 0.0, 0.0})
+                                 .getResult());
+        _config = std::make_shared<RuntimeInputSource>(_minimalCharacteristicLength, _input);
+    }
+
+    std::vector<Satellite> _input{};
+
+    double _minimalCharacteristicLength{0.1};
+
+    std::shared_ptr<RuntimeInputSource> _config;
+
+};
+
+TEST_F(EnsembleStatisticsTest, SingleRealization) {
+    auto breakup = BreakupBuilder{_config}.getBreakup();
+    breakup->setSeed(std::make_optional<std::uint64_t>(7)).run();
+    const auto &fragments = breakup->getResultSoA();
+
+    EnsembleStatistics statistics{};
+    statistics.add(fragments);
+
+    const double totalMass = std::accumulate(fragments.mass.begin(), fragments.mass.end(), 0.0);
+    ASSERT_EQ(statistics.getRealizationCount(), 1);
+    ASSERT_DOUBLE_EQ(statistics.getFragmentCount().getMean(), static_cast<double>(fragments.size()));
+    ASSERT_NEAR(statistics.getFragmentMass().getMean(), totalMass, 1e-9 * totalMass);
+    //Every fragment is counted exactly once in every histogram
+    for (const auto &histogram : statistics.getHistograms()) {
+        double countSum = 0.0;
+        double massSum = 0.0;
+        for (size_t bin = 0; bin < histogram.count.size(); ++bin) {
+            countSum += histogram.count[bin].getMean();
+            massSum += histogram.mass[bin].getMean();
+            ASSERT_EQ(histogram.count[bin].getVariance(), 0.0) << histogram.name;
+        }
+        ASSERT_DOUBLE_EQ(countSum, static_cast<double>(fragments.size())) << histogram.name;
+        ASSERT_NEAR(massSum, totalMass, 1e-9 * totalMass) << histogram.name;
+    }
+}
+
+TEST_F(EnsembleStatisticsTest, MergedEnsembleEqualsSequential) {
+    const size_t realizationCount = 12;
+    Ensemble ensemble{BreakupBuilder{_config}, realizationCount, std::make_optional<std::uint64_t>(42)};
+
+    std::vector<size_t> fragmentCounts(realizationCount);
+    std::vector<EnsembleStatistics> perRealization(realizationCount);
+    ensemble.run([&](size_t realization, const Breakup &breakup) {
+        fragmentCounts[realization] = breakup.getResultSoA().size();
+        perRealization[realization].add(breakup.getResultSoA());
+    });
+
+    //Merging in two halves gives the same moments as one sequential accumulation over the fragment counts
+    EnsembleStatistics firstHalf{};
+    EnsembleStatistics secondHalf{};
+    for (size_t realization = 0; realization < realizationCount; ++realization) {
+        (realization < realizationCount / 2 ? firstHalf : secondHalf).merge(perRealization[realization]);
+    }
+    firstHalf.merge(secondHalf);
+
+    util::MomentAccumulator expected{};
+    for (size_t count : fragmentCounts) {
+        expected.add(static_cast<double>(count));
+    }
+    ASSERT_EQ(firstHalf.getRealizationCount(), realizationCount);
+    ASSERT_NEAR(firstHalf.getFragmentCount().getMean(), expected.getMean(), 1e-9);
+    ASSERT_NEAR(firstHalf.getFragmentCount().getVariance(), expected.getVariance(), 1e-6);
+    for (const auto &histogram : firstHalf.getHistograms()) {
+        double countSum = 0.0;
+        for (const auto &bin : histogram.count) {
+            ASSERT_EQ(bin.getCount(), realizationCount) << histogram.name;
+            countSum += bin.getMean();
+        }
+        ASSERT_NEAR(countSum, expected.getMean(), 1e-9) << histogram.name;
+    }
+}
+
+TEST_F(EnsembleStatisticsTest, OutOfRangeValuesAreKeptApart) {
+    //L_c below 1 mm and above 100 m, A/M and ejection velocity outside their ranges, one fragment inside
+    Satellites fragments{50000, SatType::DEBRIS, {0.0, 0.0, 0.0}, 3};
+    fragments.characteristicLength = {5e-4, 1.0, 500.0};
+    fragments.areaToMassRatio = {1e-5, 1.0, 1e4};
+    fragments.ejectionVelocity = {{{0.1, 0.0, 0.0}}, {{100.0, 0.0, 0.0}}, {{2e4, 0.0, 0.0}}};
+    fragments.mass = {1.0, 2.0, 4.0};
+
+    EnsembleStatistics statistics{};
+    statistics.add(fragments);
+
+    for (const auto &histogram : statistics.getHistograms()) {
+        const size_t overflow = histogram.count.size() - 1;
+        //The underflow and the overflow bin hold exactly the values outside the range
+        EXPECT_EQ(histogram.count[0].getMean(), 1.0) << histogram.name;
+        EXPECT_EQ(histogram.mass[0].getMean(), 1.0) << histogram.name;
+        EXPECT_EQ(histogram.count[overflow].getMean(), 1.0) << histogram.name;
+        EXPECT_EQ(histogram.mass[overflow].getMean(), 4.0) << histogram.name;
+        EXPECT_EQ(histogram.binning.lowerBound(0), 0.0) << histogram.name;
+        EXPECT_EQ(histogram.binning.upperBound(overflow), std::numeric_limits<double>::infinity()) << histogram.name;
+        //The value inside is neither in the first nor the last regular bin
+        EXPECT_EQ(histogram.count[1].getMean(), 0.0) << histogram.name;
+        EXPECT_EQ(histogram.count[overflow - 1].getMean(), 0.0) << histogram.name;
+    }
+}
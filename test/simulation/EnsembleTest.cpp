@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/simulation/Ensemble.h"
+#include "breakupModel/simulation/Explosion.h"
+#include "breakupModel/input/RuntimeInputSource.h"
+
+class EnsembleTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        SatelliteBuilder satelliteBuilder{};
+        _input.push_back(satelliteBuilder
+                                 .setID(7946)
+                                 .setName("1975-052B")
+                                 .setSatType(SatType::ROCKET_BODY)
+                                 .setMass(839)
+                                 .setVelocity({0.0, 0.0, 0.0})
+                                 .getResult());
+        _config = std::make_shared<RuntimeInputSource>(_minimalCharacteristicLength, _input);
+    }
+
+    std::vector<Satellite> _input{};
+
+    double _minimalCharacteristicLength{0.1};
+
+    std::shared_ptr<RuntimeInputSource> _config;
+
+};
+
+TEST_F(EnsembleTest, RealizationsAreReproducible) {
+    const size_t realizationCount = 16;
+    Ensemble ensemble{BreakupBuilder{_config}, realizationCount, std::make_optional<std::uint64_t>(42)};
+
+    std::vector<std::vector<double>> masses(realizationCount);
+    std::vector<size_t> startIds(realizationCount);
+    ensemble.run([&](size_t realization, const Breakup &breakup) {
+        masses[realization] = breakup.getResultSoA().mass;
+        startIds[realization] = breakup.getResultSoA().startId;
+    });
+
+    ASSERT_LE(ensemble.getPoolSize(), realizationCount);
+    for (size_t realization = 0; realization < realizationCount; ++realization) {
+        //Every realization equals a single Breakup with the derived seed
+        Explosion explosion{_input, _minimalCharacteristicLength, 7946, false};
+        explosion.setSeed(std::make_optional(ensemble.getSeed(realization))).run();
+        ASSERT_EQ(masses[realization], explosion.getResultSoA().mass) << "Realization " << realization;
+        ASSERT_EQ(startIds[realization], 7947) << "Realization " << realization;
+        //Different realizations have different results
+        if (realization > 0) {
+            ASSERT_NE(masses[realization], masses[realization - 1]) << "Realization " << realization;
+        }
+    }
+}
@@ -4,9 +4,11 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <numeric>
 #include "breakupModel/model/Satellite.h"
 #include "breakupModel/model/SatelliteBuilder.h"
 #include "breakupModel/simulation/Explosion.h"
+#include "CollectingSink.h"
 
 class ExplosionTest : public ::testing::Test {
 
@@ -102,4 +104,109 @@ TEST_F(ExplosionTest, CheckNoRaceCondition) {
            "It could also be just a random coincidence of the RNG\n"
            "Rerun this in such a case!\n";
     }
-}
\ No newline at end of file
+}
+TEST_F(ExplosionTest, SeedReproducibility) {
+    _explosion->setSeed(std::make_optional(1234)).run();
+    auto firstOutput = _explosion->getResultSoA();
+    _explosion->setSeed(std::make_optional(1234)).run();
+    auto secondOutput = _explosion->getResultSoA();
+
+    ASSERT_EQ(firstOutput.size(), secondOutput.size());
+    ASSERT_EQ(firstOutput.characteristicLength, secondOutput.characteristicLength);
+    ASSERT_EQ(firstOutput.areaToMassRatio, secondOutput.areaToMassRatio);
+    ASSERT_EQ(firstOutput.mass, secondOutput.mass);
+    ASSERT_EQ(firstOutput.ejectionVelocity, secondOutput.ejectionVelocity);
+}
+
+TEST_F(ExplosionTest, SmallFragmentAreaToMassRatioDistribution) {
+    _explosion->setSeed(std::make_optional(4321)).run();
+    auto output = _explosion->getResultSoA();
+
+    //The log10(A/M) of fragments smaller than 8 cm follows N(mu_soc, sigma_soc), see Equation 5
+    double deviationSum = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < output.size(); ++i) {
+        const double lc = output.characteristicLength[i];
+        ASSERT_GT(output.areaToMassRatio[i], 0.0);
+        ASSERT_TRUE(std::isfinite(output.areaToMassRatio[i]));
+        if (lc < 0.08) {
+            const double logLc = std::log10(lc);
+            deviationSum += (std::log10(output.areaToMassRatio[i]) - util::mu_soc(logLc)) / util::sigma_soc(logLc);
+            ++count;
+        }
+    }
+    ASSERT_GT(count, 0);
+
+    //The mean of the standardized values should be zero, 4 standard errors as threshold
+    const double meanDeviation = deviationSum / static_cast<double>(count);
+    ASSERT_NEAR(meanDeviation, 0.0, 4.0 / std::sqrt(static_cast<double>(count)));
+}
+
+TEST_F(ExplosionTest, FusedExecutionEqualsStagedExecution) {
+    _explosion->setSeed(std::make_optional(1234)).setExecutionMode(ExecutionMode::STAGED).run();
+    auto stagedOutput = _explosion->getResultSoA();
+    _explosion->setSeed(std::make_optional(1234)).setExecutionMode(ExecutionMode::FUSED).run();
+    auto fusedOutput = _explosion->getResultSoA();
+
+    ASSERT_EQ(stagedOutput.size(), fusedOutput.size());
+    ASSERT_EQ(stagedOutput.characteristicLength, fusedOutput.characteristicLength);
+    ASSERT_EQ(stagedOutput.areaToMassRatio, fusedOutput.areaToMassRatio);
+    ASSERT_EQ(stagedOutput.mass, fusedOutput.mass);
+    ASSERT_EQ(stagedOutput.ejectionVelocity, fusedOutput.ejectionVelocity);
+    ASSERT_EQ(stagedOutput.velocity, fusedOutput.velocity);
+}
+
+TEST_F(ExplosionTest, EnforcedMassConservation) {
+    Explosion enforcedExplosion{_input, _minimalCharacteristicLength, 0, true};
+    for (std::uint64_t seed = 1; seed <= 10; ++seed) {
+        _explosion->setSeed(std::make_optional(seed)).run();
+        auto output = _explosion->getResultSoA();
+        enforcedExplosion.setSeed(std::make_optional(seed)).run();
+        auto enforcedOutput = enforcedExplosion.getResultSoA();
+
+        const double enforcedMass = std::accumulate(enforcedOutput.mass.begin(), enforcedOutput.mass.end(), 0.0);
+        ASSERT_LE(enforcedMass, sat.getMass() * (1.0 + 1e-12)) << "Seed " << seed;
+        ASSERT_GE(enforcedOutput.size(), output.size()) << "Seed " << seed;
+
+        //The additional fragments are appended, the fragments of the normal run stay the same
+        ASSERT_TRUE(std::equal(output.mass.begin(), output.mass.end(), enforcedOutput.mass.begin()))
+                                    << "Seed " << seed;
+    }
+}
+
+TEST_F(ExplosionTest, StreamingEqualsRun) {
+    for (bool enforceMassConservation : {false, true}) {
+        Explosion explosion{_input, _minimalCharacteristicLength, 0, enforceMassConservation};
+        explosion.setSeed(std::make_optional(1234)).run();
+        auto output = explosion.getResultSoA();
+
+        auto sink = std::make_shared<CollectingSink>();
+        explosion.setSeed(std::make_optional(1234)).runStreaming({sink}, 300);
+
+        ASSERT_EQ(sink->blockCount, (output.size() + 511) / 512);
+        ASSERT_EQ(sink->fragments.characteristicLength, output.characteristicLength);
+        ASSERT_EQ(sink->fragments.areaToMassRatio, output.areaToMassRatio);
+        ASSERT_EQ(sink->fragments.mass, output.mass);
+        ASSERT_EQ(sink->fragments.ejectionVelocity, output.ejectionVelocity);
+        ASSERT_EQ(sink->fragments.velocity, output.velocity);
+        ASSERT_EQ(explosion.getResultSoA().size(), 0);
+    }
+}
+
+TEST_F(ExplosionTest, TakeResult) {
+    _explosion->setSeed(std::make_optional(99)).run();
+    const Satellites &borrowed = _explosion->getResultSoA();
+    const auto expectedMass = borrowed.mass;
+    const auto expectedStartId = borrowed.startId;
+
+    Satellites taken = _explosion->takeResult();
+
+    ASSERT_EQ(taken.mass, expectedMass);
+    ASSERT_EQ(taken.startId, expectedStartId);
+    ASSERT_EQ(taken.nameTable.size(), 1);
+    ASSERT_EQ(_explosion->getResultSoA().size(), 0);
+
+    //The Breakup can be run again after its result was taken
+    _explosion->setSeed(std::make_optional(99)).run();
+    ASSERT_EQ(_explosion->getResultSoA().mass, expectedMass);
+}
@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/simulation/Scenario.h"
+#include "breakupModel/simulation/Explosion.h"
+
+class ScenarioTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        SatelliteBuilder satelliteBuilder{};
+        _input.push_back(satelliteBuilder
+                                 .setID(7946)
+                                 .setName("1975-052B")
+                                 .setSatType(SatType::ROCKET_BODY)
+                                 .setMass(839)
+                                 .setVelocity({0.0, 0.0, 0.0})
+                                 .getResult());
+    }
+
+    std::unique_ptr<Breakup> createExplosion(std::uint64_t seed) const {
+        auto explosion = std::make_unique<Explosion>(_input, _minimalCharacteristicLength, 7946, false);
+        explosion->setSeed(std::make_optional(seed));
+        return explosion;
+    }
+
+    std::vector<Satellite> _input{};
+
+    double _minimalCharacteristicLength{0.1};
+
+    const size_t _eventCount{6};
+
+};
+
+TEST_F(ScenarioTest, EventsHaveConsecutiveIDRanges) {
+    std::vector<std::unique_ptr<Breakup>> breakups{};
+    for (size_t event = 0; event < _eventCount; ++event) {
+        breakups.push_back(createExplosion(event));
+    }
+    Scenario scenario{std::move(breakups), 50000};
+
+    std::vector<size_t> order{};
+    std::vector<size_t> startIds{};
+    std::vector<std::vector<double>> masses{};
+    scenario.run([&](size_t event, const Breakup &breakup) {
+        order.push_back(event);
+        startIds.push_back(breakup.getResultSoA().startId);
+        masses.push_back(breakup.getResultSoA().mass);
+    });
+
+    ASSERT_EQ(order.size(), _eventCount);
+    size_t nextId = 50001;
+    for (size_t event = 0; event < _eventCount; ++event) {
+        //The consumer is called in the order of the events
+        ASSERT_EQ(order[event], event);
+        ASSERT_EQ(startIds[event], nextId) << "Event " << event;
+        nextId += masses[event].size();
+
+        //Every event equals a single Breakup with the same seed
+        auto explosion = createExplosion(event);
+        explosion->run();
+        ASSERT_EQ(masses[event], explosion->getResultSoA().mass) << "Event " << event;
+    }
+    ASSERT_EQ(scenario.getCurrentMaxGivenID(), nextId - 1);
+}
+
+TEST_F(ScenarioTest, ConsumerExceptionIsRethrown) {
+    std::vector<std::unique_ptr<Breakup>> breakups{};
+    breakups.push_back(createExplosion(1));
+    breakups.push_back(createExplosion(2));
+    Scenario scenario{std::move(breakups), 0};
+
+    size_t calls = 0;
+    EXPECT_THROW(scenario.run([&](size_t, const Breakup &) {
+        ++calls;
+        throw std::runtime_error{"Output failed"};
+    }), std::runtime_error);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(ScenarioTest, EventExceptionIsRethrown) {
+    std::vector<std::unique_ptr<Breakup>> breakups{};
+    breakups.push_back(createExplosion(1));
+    //An explosion without a satellite fails
+    breakups.push_back(std::make_unique<Explosion>(std::vector<Satellite>{}, _minimalCharacteristicLength, 0, false));
+    breakups.push_back(createExplosion(3));
+    Scenario scenario{std::move(breakups), 50000};
+
+    std::vector<size_t> order{};
+    std::vector<size_t> startIds{};
+    std::vector<size_t> sizes{};
+    EXPECT_THROW(scenario.run([&](size_t event, const Breakup &breakup) {
+        order.push_back(event);
+        startIds.push_back(breakup.getResultSoA().startId);
+        sizes.push_back(breakup.getResultSoA().size());
+    }), std::out_of_range);
+
+    //The other events are still handed to the consumer and continue the IDs
+    ASSERT_EQ(order, (std::vector<size_t>{0, 2}));
+    ASSERT_EQ(startIds[0], 50001);
+    ASSERT_EQ(startIds[1], 50001 + sizes[0]);
+    ASSERT_EQ(scenario.getCurrentMaxGivenID(), 50000 + sizes[0] + sizes[1]);
+}
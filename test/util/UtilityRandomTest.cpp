@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+
+#include <array>
+#include <random>
+#include <set>
+#include "breakupModel/util/UtilityRandom.h"
+
+
+class UtilityRandom : public ::testing::Test{
+
+};
+
+//Known Answer Tests taken from the Random123 library (kat_vectors, philox4x32 with 10 rounds)
+TEST_F(UtilityRandom, PhiloxKnownAnswerZero) {
+    using util::PhiloxEngine;
+    auto actual = PhiloxEngine::evaluate({{0, 0, 0, 0}}, {{0, 0}});
+    std::array<std::uint32_t, 4> expected{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}};
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(UtilityRandom, PhiloxKnownAnswerOnes) {
+    using util::PhiloxEngine;
+    auto actual = PhiloxEngine::evaluate({{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}}, {{0xffffffff, 0xffffffff}});
+    std::array<std::uint32_t, 4> expected{{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}};
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(UtilityRandom, PhiloxKnownAnswerPi) {
+    using util::PhiloxEngine;
+    auto actual = PhiloxEngine::evaluate({{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}}, {{0xa4093822, 0x299f31d0}});
+    std::array<std::uint32_t, 4> expected{{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(UtilityRandom, PhiloxStreamsAreReproducible) {
+    using util::PhiloxEngine;
+    PhiloxEngine rng1{1234, 42, 1};
+    PhiloxEngine rng2{1234, 42, 1};
+    PhiloxEngine rng3{1234, 43, 1};
+    std::uniform_real_distribution<> distribution{0.0, 1.0};
+    for (size_t i = 0; i < 10; ++i) {
+        double value1 = distribution(rng1);
+        ASSERT_DOUBLE_EQ(value1, distribution(rng2));
+        ASSERT_NE(value1, distribution(rng3));
+    }
+}
+
+TEST_F(UtilityRandom, DerivedSeedsAreDistinct) {
+    std::set<std::uint64_t> seeds{};
+    for (std::uint64_t realization = 0; realization < 1000; ++realization) {
+        seeds.insert(util::deriveSeed(42, realization));
+    }
+    ASSERT_EQ(seeds.size(), 1000);
+    ASSERT_EQ(util::deriveSeed(42, 7), util::deriveSeed(42, 7));
+    ASSERT_NE(util::deriveSeed(42, 7), util::deriveSeed(43, 7));
+}
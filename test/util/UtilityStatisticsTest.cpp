@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+
+#include <limits>
+
+#include <vector>
+#include "breakupModel/util/UtilityStatistics.h"
+
+TEST(MomentAccumulatorTest, MeanAndVariance) {
+    util::MomentAccumulator accumulator{};
+    for (double value : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0}) {
+        accumulator.add(value);
+    }
+
+    ASSERT_EQ(accumulator.getCount(), 8);
+    ASSERT_DOUBLE_EQ(accumulator.getMean(), 5.0);
+    ASSERT_DOUBLE_EQ(accumulator.getVariance(), 32.0 / 7.0);
+}
+
+TEST(MomentAccumulatorTest, MergeEqualsSequential) {
+    const std::vector<double> values{0.5, 1.5, 3.0, 10.0, 0.25, 7.0, 2.0, 2.0, 100.0, 0.0};
+    util::MomentAccumulator sequential{};
+    for (double value : values) {
+        sequential.add(value);
+    }
+
+    for (size_t split = 0; split <= values.size(); ++split) {
+        util::MomentAccumulator first{};
+        util::MomentAccumulator second{};
+        for (size_t i = 0; i < values.size(); ++i) {
+            (i < split ? first : second).add(values[i]);
+        }
+        first.merge(second);
+
+        ASSERT_EQ(first.getCount(), sequential.getCount()) << "Split " << split;
+        ASSERT_NEAR(first.getMean(), sequential.getMean(), 1e-12) << "Split " << split;
+        ASSERT_NEAR(first.getVariance(), sequential.getVariance(), 1e-10) << "Split " << split;
+    }
+}
+
+TEST(LogBinningTest, BinIndex) {
+    util::LogBinning binning{1e-3, 1e2, 5};
+
+    //Five regular bins framed by the underflow and the overflow bin
+    ASSERT_EQ(binning.getBinCount(), 7);
+    ASSERT_EQ(binning.binIndex(1e-3), 1);
+    ASSERT_EQ(binning.binIndex(2e-3), 1);
+    ASSERT_EQ(binning.binIndex(0.5), 3);
+    ASSERT_EQ(binning.binIndex(50.0), 5);
+    //Values outside are kept apart in the underflow/ overflow bin
+    ASSERT_EQ(binning.binIndex(1e-6), 0);
+    ASSERT_EQ(binning.binIndex(0.0), 0);
+    ASSERT_EQ(binning.binIndex(1e2), 6);
+    ASSERT_EQ(binning.binIndex(1e6), 6);
+    ASSERT_EQ(binning.binIndex(std::numeric_limits<double>::max()), 6);
+    ASSERT_EQ(binning.binIndex(std::numeric_limits<double>::infinity()), 6);
+    ASSERT_EQ(binning.binIndex(std::numeric_limits<double>::quiet_NaN()), 0);
+    //A position far beyond the range of size_t
+    ASSERT_EQ((util::LogBinning{1.0, 1.0 + 1e-15, 1000}.binIndex(1e300)), 1001);
+
+    ASSERT_EQ(binning.lowerBound(0), 0.0);
+    ASSERT_NEAR(binning.upperBound(0), 1e-3, 1e-15);
+    ASSERT_NEAR(binning.lowerBound(1), 1e-3, 1e-15);
+    ASSERT_NEAR(binning.upperBound(3), 1.0, 1e-12);
+    ASSERT_NEAR(binning.upperBound(5), 1e2, 1e-10);
+    ASSERT_NEAR(binning.lowerBound(6), 1e2, 1e-10);
+    ASSERT_EQ(binning.upperBound(6), std::numeric_limits<double>::infinity());
+}
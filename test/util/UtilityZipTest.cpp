@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include "breakupModel/util/UtilityZip.h"
+
+
+class UtilityZip : public ::testing::Test{
+
+};
+
+TEST_F(UtilityZip, IteratesOverAllColumns) {
+    std::vector<double> first{1.0, 2.0, 3.0};
+    std::vector<std::array<double, 3>> second{{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}, {3.0, 3.0, 3.0}};
+    util::ZipRange range{first.size(), util::IndexColumn{}, first.data(), second.data()};
+
+    ASSERT_EQ(range.size(), 3);
+    ASSERT_EQ(range.end() - range.begin(), 3);
+
+    size_t expectedIndex = 0;
+    for (auto tuple : range) {
+        auto &[index, value, array] = tuple;
+        ASSERT_EQ(index, expectedIndex);
+        ASSERT_DOUBLE_EQ(value, first[expectedIndex]);
+        ASSERT_DOUBLE_EQ(array[0], second[expectedIndex][0]);
+        ++expectedIndex;
+    }
+}
+
+TEST_F(UtilityZip, ParallelWriteThrough) {
+    std::vector<double> input(10000);
+    std::vector<double> output(10000);
+    std::iota(input.begin(), input.end(), 0.0);
+    util::ZipRange range{input.size(), util::IndexColumn{}, input.data(), output.data()};
+
+    std::for_each(std::execution::par_unseq, range.begin(), range.end(), [](auto tuple) {
+        auto &[index, in, out] = tuple;
+        out = in + static_cast<double>(index);
+    });
+
+    for (size_t i = 0; i < output.size(); ++i) {
+        ASSERT_DOUBLE_EQ(output[i], 2.0 * static_cast<double>(i));
+    }
+}
+
+TEST_F(UtilityZip, IndexRange) {
+    auto range = util::indexRange(5);
+    ASSERT_EQ(std::get<0>(range.begin()[3]), 3);
+    ASSERT_EQ(std::get<0>(*(range.end() - 1)), 4);
+    ASSERT_EQ((range.begin() + 2).index(), 2);
+}